@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/allocations.hpp"
+#include <ustdex/ustdex.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+
+namespace ex = ustdex;
+
+namespace
+{
+struct sink
+{
+  using receiver_concept = ex::receiver_t;
+  int* result;
+
+  void set_value(int value) noexcept
+  {
+    *result = value;
+  }
+
+  template <class... As>
+  void set_value(As&&...) noexcept
+  {}
+
+  template <class Error>
+  void set_error(Error&&) noexcept
+  {}
+
+  void set_stopped() noexcept {}
+};
+
+struct add_one
+{
+  int operator()(int i) const noexcept
+  {
+    return i + 1;
+  }
+};
+
+struct just_plus_one
+{
+  auto operator()(int i) const noexcept
+  {
+    return ex::just(i + 1);
+  }
+};
+
+template <std::size_t Depth, class Sndr>
+auto then_chain(Sndr sndr)
+{
+  if constexpr (Depth == 0)
+  {
+    return sndr;
+  }
+  else
+  {
+    return then_chain<Depth - 1>(static_cast<Sndr&&>(sndr) | ex::then(add_one{}));
+  }
+}
+
+template <std::size_t Depth, class Sndr>
+auto let_value_chain(Sndr sndr)
+{
+  if constexpr (Depth == 0)
+  {
+    return sndr;
+  }
+  else
+  {
+    return let_value_chain<Depth - 1>(static_cast<Sndr&&>(sndr) | ex::let_value(just_plus_one{}));
+  }
+}
+
+template <std::size_t... Is>
+auto when_all_of(std::index_sequence<Is...>)
+{
+  return ex::when_all(ex::just(static_cast<int>(Is))...);
+}
+
+// Connects and starts the sender once per iteration.
+template <class Sndr>
+void connect_and_start(benchmark::State& state, const Sndr& sndr)
+{
+  int result = 0;
+  allocation_counter allocs{state};
+  for (auto _ : state)
+  {
+    auto op = ex::connect(sndr, sink{&result});
+    ex::start(op);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+template <std::size_t Depth>
+void bm_then_chain(benchmark::State& state)
+{
+  connect_and_start(state, then_chain<Depth>(ex::just(0)));
+}
+
+template <std::size_t Depth>
+void bm_let_value_depth(benchmark::State& state)
+{
+  connect_and_start(state, let_value_chain<Depth>(ex::just(0)));
+}
+
+template <std::size_t Width>
+void bm_when_all_width(benchmark::State& state)
+{
+  connect_and_start(state, when_all_of(std::make_index_sequence<Width>()));
+}
+
+template <std::size_t Depth>
+void bm_sync_wait(benchmark::State& state)
+{
+  auto sndr = then_chain<Depth>(ex::just(0));
+  allocation_counter allocs{state};
+  for (auto _ : state)
+  {
+    auto [result] = ex::sync_wait(sndr).value();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK_TEMPLATE(bm_then_chain, 1);
+BENCHMARK_TEMPLATE(bm_then_chain, 4);
+BENCHMARK_TEMPLATE(bm_then_chain, 16);
+BENCHMARK_TEMPLATE(bm_let_value_depth, 1);
+BENCHMARK_TEMPLATE(bm_let_value_depth, 4);
+BENCHMARK_TEMPLATE(bm_let_value_depth, 8);
+BENCHMARK_TEMPLATE(bm_when_all_width, 2);
+BENCHMARK_TEMPLATE(bm_when_all_width, 8);
+BENCHMARK_TEMPLATE(bm_when_all_width, 32);
+BENCHMARK_TEMPLATE(bm_sync_wait, 0);
+BENCHMARK_TEMPLATE(bm_sync_wait, 4);
+} // namespace
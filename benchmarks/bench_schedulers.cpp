@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/allocations.hpp"
+#include <ustdex/ustdex.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ex = ustdex;
+
+namespace
+{
+// Counts completed tasks, and stops the loop once all of them have run.
+struct counting_rcvr
+{
+  using receiver_concept = ex::receiver_t;
+  ex::run_loop* loop;
+  std::size_t* remaining;
+
+  void set_value() noexcept
+  {
+    if (--*remaining == 0)
+    {
+      loop->finish();
+    }
+  }
+
+  void set_error(std::exception_ptr) noexcept
+  {
+    std::terminate();
+  }
+
+  void set_stopped() noexcept
+  {
+    std::terminate();
+  }
+};
+
+using schedule_op_t = ex::connect_result_t<decltype(ex::schedule(std::declval<ex::run_loop&>().get_scheduler())), counting_rcvr>;
+
+// N producer threads each enqueue `tasks_per_producer` tasks onto a run_loop
+// that the benchmark thread drains. The operation states are allocated once up
+// front so that only the queue itself is measured. A run_loop cannot be
+// restarted once finished, so each iteration uses a fresh one; the cost of
+// starting the producer threads is amortized over all of its tasks.
+void bm_run_loop_producers(benchmark::State& state)
+{
+  constexpr std::size_t tasks_per_producer = 4096;
+  const auto producers                     = static_cast<std::size_t>(state.range(0));
+  const std::size_t total                  = producers * tasks_per_producer;
+  auto storage = std::make_unique<std::aligned_storage_t<sizeof(schedule_op_t), alignof(schedule_op_t)>[]>(total);
+  auto* ops    = reinterpret_cast<schedule_op_t*>(storage.get());
+
+  allocation_counter allocs{state};
+  for (auto _ : state)
+  {
+    ex::run_loop loop;
+    std::size_t remaining = total;
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+    for (std::size_t p = 0; p < producers; ++p)
+    {
+      threads.emplace_back([&, p] {
+        for (std::size_t i = p * tasks_per_producer; i < (p + 1) * tasks_per_producer; ++i)
+        {
+          auto* op = ::new (static_cast<void*>(ops + i))
+            schedule_op_t(ex::connect(ex::schedule(loop.get_scheduler()), counting_rcvr{&loop, &remaining}));
+          ex::start(*op);
+        }
+      });
+    }
+    loop.run();
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    std::destroy_n(ops, total);
+  }
+  report_time_per_op(state, total);
+}
+
+// Round trip from the benchmark thread to a thread_context and back.
+void bm_thread_context_hop(benchmark::State& state)
+{
+  ex::thread_context ctx;
+  auto sch = ctx.get_scheduler();
+  allocation_counter allocs{state};
+  for (auto _ : state)
+  {
+    ex::sync_wait(ex::schedule(sch));
+  }
+}
+
+template <class Sndr, class Sch1, class Sch2, std::size_t... Is>
+auto ping_pong_chain(Sndr sndr, Sch1 sch1, Sch2 sch2, std::index_sequence<Is...>)
+{
+  return (static_cast<Sndr&&>(sndr) | ... | ex::continues_on(Is % 2 == 0 ? sch1 : sch2));
+}
+
+// Bounces between two thread_contexts with continues_on, so that each hop is a
+// transfer from one worker thread to the other.
+template <std::size_t Hops>
+void bm_thread_context_ping_pong(benchmark::State& state)
+{
+  ex::thread_context ping;
+  ex::thread_context pong;
+  auto sndr = ping_pong_chain(
+    ex::schedule(ping.get_scheduler()), pong.get_scheduler(), ping.get_scheduler(), std::make_index_sequence<Hops>());
+  allocation_counter allocs{state};
+  for (auto _ : state)
+  {
+    ex::sync_wait(sndr);
+  }
+  report_time_per_op(state, Hops);
+}
+
+struct noop_fn
+{
+  void operator()() const noexcept {}
+};
+
+using noop_callback_t = ex::inplace_stop_callback<noop_fn>;
+
+// Registers and deregisters one stop callback on a source that already has
+// state.range(0) other callbacks registered.
+void bm_stop_callback_register(benchmark::State& state)
+{
+  ex::inplace_stop_source source;
+  std::vector<std::unique_ptr<noop_callback_t>> others;
+  for (std::int64_t i = 0; i < state.range(0); ++i)
+  {
+    others.push_back(std::make_unique<noop_callback_t>(source.get_token(), noop_fn{}));
+  }
+
+  allocation_counter allocs{state};
+  for (auto _ : state)
+  {
+    noop_callback_t callback{source.get_token(), noop_fn{}};
+    benchmark::DoNotOptimize(&callback);
+  }
+}
+
+// Registers and deregisters stop callbacks on one source from several threads
+// at once, which contend for the source's lock.
+void bm_stop_callback_register_contended(benchmark::State& state)
+{
+  static ex::inplace_stop_source source;
+  allocation_counter allocs{state};
+  for (auto _ : state)
+  {
+    noop_callback_t callback{source.get_token(), noop_fn{}};
+    benchmark::DoNotOptimize(&callback);
+  }
+}
+
+BENCHMARK(bm_run_loop_producers)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(bm_thread_context_hop)->UseRealTime();
+BENCHMARK_TEMPLATE(bm_thread_context_ping_pong, 2)->UseRealTime();
+BENCHMARK_TEMPLATE(bm_thread_context_ping_pong, 16)->UseRealTime();
+BENCHMARK(bm_stop_callback_register)->Arg(0)->Arg(16);
+BENCHMARK(bm_stop_callback_register_contended)->ThreadRange(1, 8)->UseRealTime();
+} // namespace
@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ustdex/detail/variant.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <string>
+#include <utility>
+
+namespace ex = ustdex;
+
+namespace
+{
+// Alternative number I. The string member makes the alternatives
+// non-trivially destructible so that destruction has to dispatch too.
+template <std::size_t I>
+struct alt
+{
+  std::size_t value;
+  std::string name;
+};
+
+template <std::size_t... Is>
+auto make_variant(std::index_sequence<Is...>) -> ex::_variant<alt<Is>...>;
+
+template <std::size_t N>
+using variant_t = decltype(make_variant(std::make_index_sequence<N>()));
+
+struct sum_fn
+{
+  template <std::size_t I>
+  void operator()(std::size_t& sum, const alt<I>& a) const noexcept
+  {
+    sum += a.value + I;
+  }
+};
+
+template <std::size_t N, std::size_t I>
+void emplace_one(variant_t<N>& var)
+{
+  var.template _emplace_at<I>(I, std::string());
+}
+
+// Re-emplacing dispatches through a table indexed by the alternative so that
+// the cost of choosing the alternative does not grow with N. Only the
+// variant's own `_destroy` dispatch varies between the benchmarks.
+template <std::size_t N, std::size_t... Is>
+constexpr auto make_emplace_table(std::index_sequence<Is...>)
+{
+  return std::array<void (*)(variant_t<N>&), N>{{&emplace_one<N, Is>...}};
+}
+
+template <std::size_t N>
+constexpr auto emplace_table = make_emplace_table<N>(std::make_index_sequence<N>());
+
+// Visits variants whose active alternatives cycle through every index, so that
+// the branch predictor cannot learn a single path.
+template <std::size_t N>
+void bm_variant_visit(benchmark::State& state)
+{
+  constexpr std::size_t count = 64;
+  variant_t<N> vars[count];
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    emplace_table<N>[(i * 7) % N](vars[i]);
+  }
+
+  std::size_t sum = 0;
+  for (auto _ : state)
+  {
+    for (auto& var : vars)
+    {
+      var._visit(sum_fn{}, var, sum);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+// Re-emplaces each variant, which destroys the previous alternative.
+template <std::size_t N>
+void bm_variant_destroy(benchmark::State& state)
+{
+  constexpr std::size_t count = 64;
+  variant_t<N> vars[count];
+  std::size_t index = 0;
+  for (auto _ : state)
+  {
+    for (auto& var : vars)
+    {
+      index = (index + 7) % N;
+      emplace_table<N>[index](var);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * count));
+}
+
+BENCHMARK_TEMPLATE(bm_variant_visit, 2);
+BENCHMARK_TEMPLATE(bm_variant_visit, 8);
+BENCHMARK_TEMPLATE(bm_variant_visit, 32);
+BENCHMARK_TEMPLATE(bm_variant_destroy, 2);
+BENCHMARK_TEMPLATE(bm_variant_destroy, 8);
+BENCHMARK_TEMPLATE(bm_variant_destroy, 32);
+} // namespace
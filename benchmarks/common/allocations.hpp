@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+// Counts heap allocations so that benchmarks can report allocations/op. This
+// header replaces the global operator new and operator delete, so it must be
+// included by exactly one translation unit of each benchmark executable.
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<std::size_t> allocation_count{0};
+
+// Counts the allocations made while it is alive, and reports them as the
+// "allocs/op" counter, averaged over the benchmark's iterations.
+class allocation_counter
+{
+public:
+  explicit allocation_counter(benchmark::State& state) noexcept
+      : state_(state)
+      , start_(allocation_count.load(std::memory_order_relaxed))
+  {}
+
+  ~allocation_counter()
+  {
+    auto count                   = allocation_count.load(std::memory_order_relaxed) - start_;
+    state_.counters["allocs/op"] = benchmark::Counter(static_cast<double>(count), benchmark::Counter::kAvgIterations);
+  }
+
+private:
+  benchmark::State& state_;
+  std::size_t start_;
+};
+
+// Reports the time per item as the "time/op" counter, in addition to Google
+// Benchmark's time per iteration, for benchmarks whose iterations process many
+// items. The counter is in seconds, so the console shows e.g. "70ns".
+inline void report_time_per_op(benchmark::State& state, std::size_t items_per_iteration)
+{
+  auto items = static_cast<std::int64_t>(state.iterations() * items_per_iteration);
+  state.SetItemsProcessed(items);
+  state.counters["time/op"] =
+    benchmark::Counter(static_cast<double>(items), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+} // namespace
+
+// The replacements are kept out of line: when GCC inlines the call to free()
+// into a caller that got its pointer from operator new, it warns about a
+// mismatched deallocation.
+#if defined(__GNUC__)
+#  define USTDEX_BENCH_NOINLINE __attribute__((noinline))
+#else
+#  define USTDEX_BENCH_NOINLINE
+#endif
+
+USTDEX_BENCH_NOINLINE void* operator new(std::size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+USTDEX_BENCH_NOINLINE void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+USTDEX_BENCH_NOINLINE void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
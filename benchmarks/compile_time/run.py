@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 NVIDIA Corporation
+#
+# Licensed under the Apache License Version 2.0 with LLVM Exceptions
+# (the "License"); you may not use this file except in compliance with
+# the License. You may obtain a copy of the License at
+#
+#   https://llvm.org/LICENSE.txt
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compile-time benchmarks for ustdex.
+
+Generates synthetic pipelines of increasing depth and width, compiles each one
+with -fsyntax-only so that only the frontend runs, and writes the results as
+JSON. Each case reports the wall-clock frontend time (best of --repetitions)
+and, where the OS reports it, the compiler's peak memory use.
+With Clang, each case also reports the number and total duration of class and
+function template instantiations, read from the -ftime-trace output.
+
+The "baseline" case includes <ustdex/ustdex.hpp> and does nothing else.
+Subtract it to get the cost of the pipelines themselves. Each then stage nests
+several templates deep, so the cases are compiled with a raised
+-ftemplate-depth. A case that fails to compile is recorded with its error and
+does not stop the others.
+"""
+
+import argparse
+import json
+import os
+import pathlib
+import subprocess
+import sys
+import time
+
+PROLOGUE = """\
+#include <ustdex/ustdex.hpp>
+
+namespace ex = ustdex;
+
+"""
+
+
+def gen_baseline(_):
+    return PROLOGUE
+
+
+def gen_then(depth):
+    # Each stage has its own lambda type, as in a hand-written pipeline.
+    stages = "".join(f"\n    | ex::then([](int i) {{ return i + {i}; }})" for i in range(depth))
+    return PROLOGUE + f"int run()\n{{\n  auto sndr = ex::just(0){stages};\n" \
+        "  auto [result] = ex::sync_wait(std::move(sndr)).value();\n  return result;\n}\n"
+
+
+def gen_when_all(width):
+    # The then stages are not noexcept, so every child adds an exception_ptr
+    # error completion that when_all must deduplicate.
+    children = ",\n    ".join(f"ex::just({i}) | ex::then([](int i) {{ return i + {i}; }})" for i in range(width))
+    return PROLOGUE + f"void run()\n{{\n  auto sndr = ex::when_all(\n    {children});\n" \
+        "  ex::sync_wait(std::move(sndr));\n}\n"
+
+
+def gen_let_value(depth):
+    stages = "".join(f"\n    | ex::let_value([](int i) {{ return ex::just(i + {i}); }})" for i in range(depth))
+    return PROLOGUE + f"int run()\n{{\n  auto sndr = ex::just(0){stages};\n" \
+        "  auto [result] = ex::sync_wait(std::move(sndr)).value();\n  return result;\n}\n"
+
+
+def gen_concat(count):
+    # Merges `count` signature sets that each add one value completion and
+    # repeat the same error and stopped completions, as when_all does.
+    sets = ",\n    ".join(f"sigs<{i}>()" for i in range(count))
+    return PROLOGUE + "template <int I>\nstruct value {};\n\ntemplate <int I>\n" \
+        "using sigs = ex::completion_signatures<ex::set_value_t(value<I>), " \
+        "ex::set_error_t(std::exception_ptr), ex::set_stopped_t()>;\n\n" \
+        f"constexpr auto all = ex::concat_completion_signatures(\n    {sets});\n" \
+        f"static_assert(all.count(ex::set_value_t()) == {count});\n" \
+        "static_assert(all.count(ex::set_error_t()) == 1);\n"
+
+
+CASES = {
+    "baseline": (gen_baseline, [0]),
+    "then": (gen_then, [10, 25, 50, 100, 200]),
+    "when_all": (gen_when_all, [2, 8, 16, 32, 64]),
+    "let_value": (gen_let_value, [2, 4, 6, 8]),
+    "concat": (gen_concat, [16, 64, 256]),
+}
+
+
+def summarize_time_trace(trace_file):
+    """Returns the instantiation totals that Clang records in a -ftime-trace file."""
+    with open(trace_file) as f:
+        events = json.load(f)["traceEvents"]
+    totals = {}
+    for event in events:
+        name = event.get("name", "")
+        if name.startswith("Total "):
+            totals[name[len("Total "):]] = event
+    result = {}
+    for key, label in (("InstantiateClass", "class_instantiations"),
+                       ("InstantiateFunction", "function_instantiations"),
+                       ("Frontend", "frontend")):
+        if key in totals:
+            args = totals[key].get("args", {})
+            result[label] = {"count": args.get("count"), "ms": args.get("avg ms", 0) * args.get("count", 1)}
+    return result
+
+
+def run_compiler(command, cwd):
+    """Runs the compiler, and returns its peak memory use in MiB where the OS reports it."""
+    process = subprocess.Popen(command, cwd=cwd, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    stderr = process.stderr.read()
+    if hasattr(os, "wait4"):
+        _, status, usage = os.wait4(process.pid, 0)
+        returncode = os.waitstatus_to_exitcode(status)
+        # ru_maxrss is in KiB on Linux and in bytes on macOS.
+        peak_mib = usage.ru_maxrss / (1024 * 1024 if sys.platform == "darwin" else 1024)
+    else:
+        returncode = process.wait()
+        peak_mib = None
+    if returncode != 0:
+        raise subprocess.CalledProcessError(returncode, command, stderr=stderr)
+    return peak_mib
+
+
+def compile_case(args, source, is_clang):
+    """Returns the best compile time in seconds and the peak memory in MiB."""
+    include_dir = pathlib.Path(args.include_dir).resolve()
+    command = [args.compiler, "-std=c++17", "-fsyntax-only", "-ftemplate-depth=4096", f"-I{include_dir}", *args.flags]
+    if is_clang:
+        command.append("-ftime-trace")
+    command.append(str(source))
+    best = None
+    for _ in range(args.repetitions):
+        start = time.perf_counter()
+        peak_mib = run_compiler(command, source.parent)
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best, peak_mib
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", required=True, help="the C++ compiler to benchmark")
+    parser.add_argument("--include-dir", required=True, help="the ustdex include directory")
+    parser.add_argument("--work-dir", required=True, help="where to write the generated sources")
+    parser.add_argument("--output", required=True, help="the JSON file to write the results to")
+    parser.add_argument("--repetitions", type=int, default=3, help="compile each case this many times")
+    parser.add_argument("--filter", default="", help="only run the cases whose kind contains this string")
+    parser.add_argument("--flag", dest="flags", action="append", default=[], help="an extra compiler flag")
+    args = parser.parse_args()
+
+    version = subprocess.run([args.compiler, "--version"], check=True, capture_output=True, text=True).stdout
+    is_clang = "clang" in version.lower()
+    work_dir = pathlib.Path(args.work_dir).resolve()
+    work_dir.mkdir(parents=True, exist_ok=True)
+
+    results = []
+    for kind, (generate, sizes) in CASES.items():
+        if args.filter not in kind:
+            continue
+        for size in sizes:
+            name = f"{kind}_{size}"
+            source = work_dir / f"{name}.cpp"
+            source.write_text(generate(size))
+            result = {"name": name, "kind": kind, "size": size}
+            try:
+                seconds, peak_mib = compile_case(args, source, is_clang)
+            except subprocess.CalledProcessError as error:
+                result["error"] = error.stderr.splitlines()[-1] if error.stderr else str(error)
+                print(f"{name:<16} {'failed':>13}", flush=True)
+            else:
+                result["frontend_ms"] = seconds * 1e3
+                result["peak_memory_mib"] = peak_mib
+                trace = source.with_suffix(".json")
+                if is_clang and trace.exists():
+                    result.update(summarize_time_trace(trace))
+                memory = f"{peak_mib:8.0f} MiB" if peak_mib is not None else ""
+                print(f"{name:<16} {seconds * 1e3:10.1f} ms {memory}", flush=True)
+            results.append(result)
+
+    output = pathlib.Path(args.output)
+    output.parent.mkdir(parents=True, exist_ok=True)
+    with open(output, "w") as f:
+        json.dump({"context": {"compiler": args.compiler, "version": version.splitlines()[0], "flags": args.flags},
+                   "benchmarks": results}, f, indent=2)
+        f.write("\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Runs a pipeline that hops between two thread contexts, and writes its trace
+// as Chrome Trace Event JSON. Open the file in https://ui.perfetto.dev to see
+// where each request waited in a queue and where it ran.
+
+#include <cstdio>
+
+#include "ustdex/ustdex.hpp"
+
+using namespace ustdex;
+
+int main(int argc, char* argv[])
+{
+  const char* path = argc > 1 ? argv[1] : "ustdex_trace.json";
+
+  trace_recorder recorder;
+  thread_context io_ctx;
+  thread_context cpu_ctx;
+
+  for (int request = 0; request < 8; ++request)
+  {
+    auto parse   = starts_on(io_ctx.get_scheduler(), just(request)) | then([](int i) {
+                   return i * 10;
+                 });
+    auto compute = continues_on(std::move(parse), cpu_ctx.get_scheduler()) | let_value([](int i) {
+                     return when_all(just(i), just(i + 1)) | then([](int a, int b) {
+                              return a + b;
+                            });
+                   });
+    auto respond = continues_on(std::move(compute), io_ctx.get_scheduler());
+    sync_wait(write_env(std::move(respond), prop{get_tracer, recorder.tracer()}));
+  }
+
+  // Let the contexts finish recording before exporting.
+  io_ctx.join();
+  cpu_ctx.join();
+
+  std::FILE* file = std::fopen(path, "w");
+  if (file == nullptr)
+  {
+    std::perror(path);
+    return 1;
+  }
+  auto json = recorder.to_json();
+  std::fwrite(json.data(), 1, json.size(), file);
+  std::fclose(file);
+  std::printf("wrote %zu events to %s\n", recorder.recorded(), path);
+  return 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Uses ustdex through its C++20 named module rather than its headers. Built
+// when ustdex is configured with -DUSTDEX_BUILD_MODULE=ON.
+
+#include <cstdio>
+#include <utility>
+
+import ustdex;
+
+int main()
+{
+  ustdex::thread_context ctx;
+  auto sndr = ustdex::starts_on(ctx.get_scheduler(), ustdex::just(41)) //
+            | ustdex::then([](int i) {
+                return i + 1;
+              });
+  auto [result] = ustdex::sync_wait(std::move(sndr)).value();
+  std::printf("result: %d\n", result);
+  return result == 42 ? 0 : 1;
+}
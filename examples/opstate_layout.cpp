@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Prints the operation-state layout of a few representative pipelines, and
+// how many heap allocations it takes to run each of them to completion.
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "ustdex/ustdex.hpp"
+
+using namespace ustdex;
+
+namespace
+{
+std::atomic<std::size_t> allocations{0};
+} // namespace
+
+// Like the counting allocator of the benchmarks, the replacements are kept out
+// of line: when GCC inlines the call to free() into a caller that got its
+// pointer from operator new, it warns about a mismatched deallocation.
+#if defined(__GNUC__)
+#  define USTDEX_EXAMPLE_NOINLINE __attribute__((noinline))
+#else
+#  define USTDEX_EXAMPLE_NOINLINE
+#endif
+
+USTDEX_EXAMPLE_NOINLINE void* operator new(std::size_t size)
+{
+  ++allocations;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+USTDEX_EXAMPLE_NOINLINE void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+USTDEX_EXAMPLE_NOINLINE void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+template <class Sndr>
+void report(const char* title, Sndr sndr)
+{
+  std::printf("== %s\n%s", title, get_opstate_layout(sndr).to_string().c_str());
+  std::size_t before = allocations.load();
+  sync_wait(static_cast<Sndr&&>(sndr));
+  std::printf("allocations: %zu\n\n", allocations.load() - before);
+}
+
+int main()
+{
+  thread_context ctx;
+  auto sch = ctx.get_scheduler();
+
+  report("then chain", just(1) | then([](int i) {
+                         return i + 1;
+                       }) | then([](int i) {
+                         return i * 2;
+                       }));
+
+  report("let_value", just(1) | let_value([](int i) {
+                        return just(i, 2.0);
+                      }));
+
+  report("when_all", when_all(just(1), just(2.0) | then([](double d) {
+                                         return d / 2;
+                                       }),
+                              just()));
+
+  report("thread hop", starts_on(sch, just(1)) | continues_on(sch) | then([](int i) {
+                         return i;
+                       }));
+}
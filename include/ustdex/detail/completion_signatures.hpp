@@ -94,60 +94,24 @@ inline constexpr struct _concat_completion_signatures_fn
   }
 } concat_completion_signatures{};
 
-extern const completion_signatures<>& _empty_completion_signatures;
-
 struct _concat_completion_signatures_helper
 {
-  USTDEX_TRIVIAL_API constexpr auto operator()() const noexcept -> completion_signatures<> (*)()
-  {
-    return nullptr;
-  }
-
+  // Concatenates all the lists in one step and removes duplicates once, rather
+  // than merging the lists a few at a time.
   template <class... Sigs>
-  USTDEX_TRIVIAL_API constexpr auto operator()(const completion_signatures<Sigs...>&) const noexcept
-    -> _make_completion_signatures_t<Sigs...> (*)()
-  {
-    return nullptr;
-  }
-
-  template <class Self = _concat_completion_signatures_helper,
-            class... As,
-            class... Bs,
-            class... Cs,
-            class... Ds,
-            class... Rest>
-  USTDEX_TRIVIAL_API constexpr auto operator()(
-    const completion_signatures<As...>&,
-    const completion_signatures<Bs...>&,
-    const completion_signatures<Cs...>& = _empty_completion_signatures,
-    const completion_signatures<Ds...>& = _empty_completion_signatures,
-    const Rest&...) const noexcept
-  {
-    using Tmp       = completion_signatures<As..., Bs..., Cs..., Ds...>;
-    using SigsFnPtr = _call_result_t<Self, const Tmp&, const Rest&...>;
-    return static_cast<SigsFnPtr>(nullptr);
-  }
-
-  template <class Ap, class Bp = _ignore, class Cp = _ignore, class Dp = _ignore, class... Rest>
-  USTDEX_TRIVIAL_API constexpr auto
-  operator()(const Ap&, const Bp& = {}, const Cp& = {}, const Dp& = {}, const Rest&...) const noexcept
+  USTDEX_TRIVIAL_API constexpr auto operator()(const Sigs&...) const noexcept
   {
-    if constexpr (!_valid_completion_signatures<Ap>)
-    {
-      return static_cast<Ap (*)()>(nullptr);
-    }
-    else if constexpr (!_valid_completion_signatures<Bp>)
-    {
-      return static_cast<Bp (*)()>(nullptr);
-    }
-    else if constexpr (!_valid_completion_signatures<Cp>)
+    if constexpr ((_valid_completion_signatures<Sigs> && ...))
     {
-      return static_cast<Cp (*)()>(nullptr);
+      using _all_sigs_t = _m_call<_m_concat, Sigs...>;
+      return static_cast<_m_apply_q<_make_completion_signatures_t, _all_sigs_t> (*)()>(nullptr);
     }
     else
     {
-      static_assert(!_valid_completion_signatures<Dp>);
-      return static_cast<Dp (*)()>(nullptr);
+      // Propagate the first argument that is not a set of completion
+      // signatures. It is an error that describes what went wrong.
+      constexpr bool _invalid[] = {!_valid_completion_signatures<Sigs>...};
+      return static_cast<_m_index<ustdex::_find_pos(_invalid, _invalid + sizeof...(Sigs)), Sigs...> (*)()>(nullptr);
     }
   }
 };
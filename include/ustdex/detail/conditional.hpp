@@ -131,12 +131,12 @@ struct _cond_t
       {
         if (static_cast<Pred&&>(_data_._pred_)(_as...))
         {
-          auto& _op = _ops_._emplace_from(connect, static_cast<Then&&>(_data_._then_)(_just), _rcvr_ref{_rcvr_});
+          auto& _op = _ops_._emplace_from(connect, static_cast<Then&&>(_data_._then_)(_just), _rcvr_ref<Rcvr>{_rcvr_});
           ustdex::start(_op);
         }
         else
         {
-          auto& _op = _ops_._emplace_from(connect, static_cast<Else&&>(_data_._else_)(_just), _rcvr_ref{_rcvr_});
+          auto& _op = _ops_._emplace_from(connect, static_cast<Else&&>(_data_._else_)(_just), _rcvr_ref<Rcvr>{_rcvr_});
           ustdex::start(_op);
         }
       }
@@ -182,6 +182,31 @@
 #  define USTDEX_HOST_ONLY() 1
 #endif
 
+// Whether the host provides POSIX threads, for the thread settings that
+// std::thread does not expose.
+#if defined(__unix__) || defined(__APPLE__)
+#  define USTDEX_PTHREADS() 1
+#else
+#  define USTDEX_PTHREADS() 0
+#endif
+
+// Define USTDEX_ENABLE_RUN_LOOP_METRICS to have run_loop record its queue
+// depth and task timings. Every translation unit must agree on it.
+#if defined(USTDEX_ENABLE_RUN_LOOP_METRICS)
+#  define USTDEX_RUN_LOOP_METRICS() 1
+#else
+#  define USTDEX_RUN_LOOP_METRICS() 0
+#endif
+
+// Define USTDEX_ENABLE_LOCK_PROFILING to have the run_loop mutex and the
+// inplace_stop_source spin lock count their acquisitions and contention.
+// Every translation unit must agree on it. Host only.
+#if defined(USTDEX_ENABLE_LOCK_PROFILING) && !defined(__CUDA_ARCH__)
+#  define USTDEX_LOCK_PROFILING() 1
+#else
+#  define USTDEX_LOCK_PROFILING() 0
+#endif
+
 #if defined(__CUDACC__) || defined(_NVHPC_CUDA)
 #  define USTDEX_CUDA_COMPILATION() 1
 #else
@@ -24,6 +24,7 @@
 #include "meta.hpp"
 #include "queries.hpp"
 #include "rcvr_ref.hpp"
+#include "trace.hpp"
 #include "tuple.hpp"
 #include "variant.hpp"
 
@@ -115,22 +116,60 @@ private:
     using _result_t =
       typename completion_signatures_of_t<CvSndr, _env_t>::template _transform_q<_decayed_tuple, _variant>;
 
+    // If the predecessor advertises the scheduler it completes on, and that
+    // scheduler has the same type as the target one, we can compare them at
+    // runtime. When they are equal, the values are already being delivered on
+    // the target scheduler, and there is no need to store them and hop.
+    using _cmpl_sch_t =
+      _m_call<_m_try_q<_call_result_t, void>, get_completion_scheduler_t<set_value_t>, env_of_t<CvSndr>>;
+    static constexpr bool _may_skip_hop = USTDEX_IS_SAME(USTDEX_DECAY(_cmpl_sch_t), Sch);
+
+    USTDEX_API static auto _same_scheduler(const CvSndr& _sndr, const Sch& _sch) noexcept -> bool
+    {
+      if constexpr (_may_skip_hop)
+      {
+        return get_completion_scheduler<set_value_t>(ustdex::get_env(_sndr)) == _sch;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
     USTDEX_API _opstate_t(CvSndr&& _sndr, Sch _sch, Rcvr _rcvr)
+        : _opstate_t{_same_scheduler(_sndr, _sch), static_cast<CvSndr&&>(_sndr), _sch, static_cast<Rcvr&&>(_rcvr)}
+    {}
+
+    USTDEX_API _opstate_t(bool _skip_hop, CvSndr&& _sndr, Sch _sch, Rcvr _rcvr)
         : _rcvr_{static_cast<Rcvr&&>(_rcvr), {}, nullptr}
         , _opstate1_{ustdex::connect(static_cast<CvSndr&&>(_sndr), _rcvr_ref{*this})}
         , _opstate2_{ustdex::connect(schedule(_sch), _rcvr_ref{_rcvr_})}
-    {}
+    {
+      if constexpr (_may_skip_hop)
+      {
+        _skip_hop_ = _skip_hop;
+      }
+    }
 
     USTDEX_IMMOVABLE(_opstate_t);
 
     USTDEX_API void start() noexcept
     {
+      ustdex::_trace_start(_rcvr_._rcvr_);
       ustdex::start(_opstate1_);
     }
 
     template <class... As>
     USTDEX_API void set_value(As&&... _as) noexcept
     {
+      if constexpr (_may_skip_hop)
+      {
+        if (_skip_hop_)
+        {
+          ustdex::set_value(static_cast<Rcvr&&>(_rcvr_._rcvr_), static_cast<As&&>(_as)...);
+          return;
+        }
+      }
       _rcvr_._set_result(set_value_t(), static_cast<As&&>(_as)...);
       ustdex::start(_opstate2_);
     }
@@ -150,12 +189,13 @@ private:
 
     USTDEX_API auto get_env() const noexcept -> _env_t
     {
-      return ustdex::get_env(_rcvr_._rcvr);
+      return ustdex::get_env(_rcvr_._rcvr_);
     }
 
     _rcvr_t<Rcvr, _result_t> _rcvr_;
     connect_result_t<CvSndr, _rcvr_ref<_opstate_t, _env_t>> _opstate1_;
     connect_result_t<schedule_result_t<Sch>, _rcvr_ref<_rcvr_t<Rcvr, _result_t>>> _opstate2_;
+    USTDEX_NO_UNIQUE_ADDRESS _m_if<_may_skip_hop, bool, _empty> _skip_hop_;
   };
 
   template <class Sndr, class Sch>
@@ -211,25 +251,25 @@ template <class Sndr, class Sch>
 struct USTDEX_TYPE_VISIBILITY_DEFAULT continue_on_t::_sndr_t
 {
   using sender_concept = sender_t;
-  USTDEX_NO_UNIQUE_ADDRESS continue_on_t _tag;
-  Sch _sch;
-  Sndr _sndr;
+  USTDEX_NO_UNIQUE_ADDRESS continue_on_t _tag_;
+  Sch _sch_;
+  Sndr _sndr_;
 
   struct USTDEX_TYPE_VISIBILITY_DEFAULT _attrs_t
   {
-    _sndr_t* _sndr;
+    const _sndr_t* _sndr;
 
     template <class SetTag>
     USTDEX_API auto query(get_completion_scheduler_t<SetTag>) const noexcept
     {
-      return _sndr->_sch;
+      return _sndr->_sch_;
     }
 
     template <class Query>
     USTDEX_API auto query(Query) const //
       -> _query_result_t<Query, env_of_t<Sndr>>
     {
-      return ustdex::get_env(_sndr->_sndr).query(Query{});
+      return ustdex::get_env(_sndr->_sndr_).query(Query{});
     }
   };
 
@@ -249,15 +289,15 @@ struct USTDEX_TYPE_VISIBILITY_DEFAULT continue_on_t::_sndr_t
   }
 
   template <class Rcvr>
-  USTDEX_API _opstate_t<Rcvr, Sndr, Sch> connect(Rcvr _rcvr) &&
+  USTDEX_API _opstate_t<_traced_rcvr_t<continue_on_t, Rcvr>, Sndr, Sch> connect(Rcvr _rcvr) &&
   {
-    return {static_cast<Sndr&&>(_sndr), _sch, static_cast<Rcvr&&>(_rcvr)};
+    return {static_cast<Sndr&&>(_sndr_), _sch_, ustdex::_trace_rcvr<continue_on_t>(static_cast<Rcvr&&>(_rcvr))};
   }
 
   template <class Rcvr>
-  USTDEX_API _opstate_t<Rcvr, const Sndr&, Sch> connect(Rcvr _rcvr) const&
+  USTDEX_API _opstate_t<_traced_rcvr_t<continue_on_t, Rcvr>, const Sndr&, Sch> connect(Rcvr _rcvr) const&
   {
-    return {_sndr, _sch, static_cast<Rcvr&&>(_rcvr)};
+    return {_sndr_, _sch_, ustdex::_trace_rcvr<continue_on_t>(static_cast<Rcvr&&>(_rcvr))};
   }
 
   USTDEX_API _attrs_t get_env() const noexcept
@@ -279,6 +319,9 @@ USTDEX_TRIVIAL_API continue_on_t::_closure_t<Sch> continue_on_t::operator()(Sch
 }
 
 inline constexpr continue_on_t continues_on{};
+
+template <>
+inline constexpr const char* trace_name_v<continue_on_t> = "continues_on";
 } // namespace ustdex
 
 #include "epilogue.hpp"
@@ -0,0 +1,657 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_EPOLL_CONTEXT
+#define USTDEX_DETAIL_EPOLL_CONTEXT
+
+#include "config.hpp"
+
+// The epoll reactor is only available on Linux hosts.
+#if defined(__linux__) && !defined(__CUDA_ARCH__)
+
+#  include "completion_signatures.hpp"
+#  include "cpos.hpp"
+#  include "env.hpp"
+#  include "exception.hpp"
+#  include "lazy.hpp"
+#  include "queries.hpp"
+#  include "run_loop.hpp"
+#  include "stop_token.hpp"
+#  include "utility.hpp"
+
+#  include <atomic>
+#  include <cerrno>
+#  include <mutex>
+#  include <system_error>
+
+#  include <signal.h>
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  include <sys/signalfd.h>
+#  include <sys/syscall.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+class epoll_context;
+
+namespace _epoll
+{
+USTDEX_API inline auto _last_error() noexcept -> std::error_code
+{
+  return std::error_code{errno, std::system_category()};
+}
+
+// Waits for a signal from a set of blocked signals to become pending. The
+// signal must be blocked in every thread of the process (e.g. with
+// `pthread_sigmask` before any threads are created), otherwise it is delivered
+// normally and the wait never completes.
+struct _signal_kind
+{
+  using _arg_t   = int;
+  using _value_t = signalfd_siginfo;
+
+  static auto _open(int _signo) noexcept -> int
+  {
+    ::sigset_t _set;
+    ::sigemptyset(&_set);
+    if (::sigaddset(&_set, _signo) != 0)
+    {
+      return -1;
+    }
+    return ::signalfd(-1, &_set, SFD_NONBLOCK | SFD_CLOEXEC);
+  }
+
+  static auto _read(int _fd, signalfd_siginfo& _info) noexcept -> int
+  {
+    if (::read(_fd, &_info, sizeof(_info)) != static_cast<::ssize_t>(sizeof(_info)))
+    {
+      return errno;
+    }
+    return 0;
+  }
+};
+
+// Waits for a child process to exit and reaps it. Requires Linux 5.4 or later
+// for `pidfd_open` and `waitid(P_PIDFD)`.
+struct _child_kind
+{
+  using _arg_t   = ::pid_t;
+  using _value_t = ::siginfo_t;
+
+  static auto _open(::pid_t _pid) noexcept -> int
+  {
+#  if defined(SYS_pidfd_open)
+    return static_cast<int>(::syscall(SYS_pidfd_open, _pid, 0));
+#  else
+    errno = ENOSYS;
+    return -1;
+#  endif
+  }
+
+  static auto _read(int _fd, ::siginfo_t& _info) noexcept -> int
+  {
+#  if defined(P_PIDFD)
+    constexpr ::idtype_t _p_pidfd = P_PIDFD;
+#  else
+    constexpr ::idtype_t _p_pidfd = static_cast<::idtype_t>(3);
+#  endif
+    _info = {};
+    if (::waitid(_p_pidfd, static_cast<::id_t>(_fd), &_info, WEXITED | WNOHANG) != 0)
+    {
+      return errno;
+    }
+    // With WNOHANG, a zero pid means the child has not exited yet.
+    return _info.si_pid == 0 ? EAGAIN : 0;
+  }
+};
+
+template <class Rcvr>
+struct _schedule_op;
+
+template <class Rcvr, class Kind>
+struct _wait_op;
+} // namespace _epoll
+
+//! \brief An event loop that multiplexes scheduled work and file-descriptor
+//! readiness on a single thread using `epoll`.
+//!
+//! Call `run()` from the thread that should drive the loop. `run()` returns
+//! once `finish()` has been called and all scheduled work has been executed.
+//! Outstanding waits must be completed or cancelled before the context is
+//! destroyed.
+class USTDEX_TYPE_VISIBILITY_DEFAULT epoll_context
+{
+  template <class>
+  friend struct _epoll::_schedule_op;
+
+  template <class, class>
+  friend struct _epoll::_wait_op;
+
+public:
+  epoll_context()
+      : _epoll_fd_{::epoll_create1(EPOLL_CLOEXEC)}
+  {
+    if (_epoll_fd_ < 0)
+    {
+      USTDEX_THROW(std::system_error(_epoll::_last_error(), "epoll_create1"));
+    }
+
+    _event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_event_fd_ < 0)
+    {
+      auto _err = _epoll::_last_error();
+      ::close(_epoll_fd_);
+      USTDEX_THROW(std::system_error(_err, "eventfd"));
+    }
+
+    // A null data pointer identifies the wakeup event.
+    ::epoll_event _evt{};
+    _evt.events   = EPOLLIN;
+    _evt.data.ptr = nullptr;
+    if (::epoll_ctl(_epoll_fd_, EPOLL_CTL_ADD, _event_fd_, &_evt) != 0)
+    {
+      auto _err = _epoll::_last_error();
+      ::close(_event_fd_);
+      ::close(_epoll_fd_);
+      USTDEX_THROW(std::system_error(_err, "epoll_ctl"));
+    }
+
+    _head_._next_ = _head_._tail_ = &_head_;
+  }
+
+  ~epoll_context()
+  {
+    ::close(_event_fd_);
+    ::close(_epoll_fd_);
+  }
+
+  USTDEX_IMMOVABLE(epoll_context);
+
+  class _scheduler
+  {
+    struct _schedule_task
+    {
+      using sender_concept = sender_t;
+
+      template <class Rcvr>
+      USTDEX_API auto connect(Rcvr _rcvr) const noexcept -> _epoll::_schedule_op<Rcvr>
+      {
+        return _epoll::_schedule_op<Rcvr>{_ctx_, static_cast<Rcvr&&>(_rcvr)};
+      }
+
+      template <class Self>
+      USTDEX_API static constexpr auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_error_t(::std::exception_ptr), set_stopped_t()>();
+      }
+
+      struct _env
+      {
+        epoll_context* _ctx_;
+
+        template <class Tag>
+        USTDEX_API auto query(get_completion_scheduler_t<Tag>) const noexcept -> _scheduler
+        {
+          return _ctx_->get_scheduler();
+        }
+      };
+
+      USTDEX_API auto get_env() const noexcept -> _env
+      {
+        return _env{_ctx_};
+      }
+
+    private:
+      friend _scheduler;
+
+      USTDEX_API explicit _schedule_task(epoll_context* _ctx) noexcept
+          : _ctx_(_ctx)
+      {}
+
+      epoll_context* const _ctx_;
+    };
+
+    friend epoll_context;
+
+    template <class Kind>
+    friend struct _wait_sndr_t;
+
+    USTDEX_API explicit _scheduler(epoll_context* _ctx) noexcept
+        : _ctx_(_ctx)
+    {}
+
+    USTDEX_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    epoll_context* _ctx_;
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    [[nodiscard]] USTDEX_API auto schedule() const noexcept -> _schedule_task
+    {
+      return _schedule_task{_ctx_};
+    }
+
+    USTDEX_API friend bool operator==(const _scheduler& _a, const _scheduler& _b) noexcept
+    {
+      return _a._ctx_ == _b._ctx_;
+    }
+
+    USTDEX_API friend bool operator!=(const _scheduler& _a, const _scheduler& _b) noexcept
+    {
+      return _a._ctx_ != _b._ctx_;
+    }
+  };
+
+  USTDEX_API auto get_scheduler() noexcept -> _scheduler
+  {
+    return _scheduler{this};
+  }
+
+  USTDEX_API void run();
+
+  USTDEX_API void finish();
+
+private:
+  USTDEX_API void _push_back(_task* _tsk);
+  USTDEX_API auto _pop_all() -> _task*;
+  USTDEX_API void _wakeup() noexcept;
+
+  std::mutex _mutex_{};
+  _task _head_{};
+  bool _stop_    = false;
+  int _epoll_fd_ = -1;
+  int _event_fd_ = -1;
+};
+
+namespace _epoll
+{
+template <class Rcvr>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT _schedule_op : _task
+{
+  using operation_state_concept = operation_state_t;
+
+  USTDEX_API _schedule_op(epoll_context* _ctx, Rcvr _rcvr)
+      : _task{this, &_execute_impl}
+      , _ctx_{_ctx}
+      , _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+  {}
+
+  USTDEX_IMMOVABLE(_schedule_op);
+
+  USTDEX_API static void _execute_impl(_task* _p) noexcept
+  {
+    auto& _rcvr = static_cast<_schedule_op*>(_p)->_rcvr_;
+    if (get_stop_token(get_env(_rcvr)).stop_requested())
+    {
+      set_stopped(static_cast<Rcvr&&>(_rcvr));
+    }
+    else
+    {
+      set_value(static_cast<Rcvr&&>(_rcvr));
+    }
+  }
+
+  USTDEX_API void start() & noexcept
+  {
+    USTDEX_TRY
+    {
+      _ctx_->_push_back(this);
+    }
+    USTDEX_CATCH(...)
+    {
+      set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+    }
+  }
+
+  epoll_context* _ctx_;
+  Rcvr _rcvr_;
+};
+
+// The life cycle of a wait operation, all of which happens on the thread that
+// is running the context except for the stop request:
+//
+//   1. `start()` enqueues the operation. When dequeued, it opens the file
+//      descriptor, registers it with epoll and installs the stop callback.
+//   2. When the descriptor becomes readable, the stop callback is destroyed.
+//      If no stop was requested, the event is consumed and the operation
+//      completes with the value.
+//   3. A stop request sets a flag and enqueues a cancellation task, which
+//      deregisters the descriptor and completes the operation with
+//      `set_stopped`.
+//
+// Because registration, readiness and cancellation are all serialized on the
+// context's thread, the operation is never completed twice and the epoll event
+// never refers to a destroyed operation.
+template <class Rcvr, class Kind>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT _wait_op : _task
+{
+  using operation_state_concept = operation_state_t;
+  using _arg_t                  = typename Kind::_arg_t;
+  using _value_t                = typename Kind::_value_t;
+
+  struct _on_stop_t
+  {
+    _wait_op* _self_;
+
+    USTDEX_API void operator()() const noexcept
+    {
+      _self_->_stop_requested_.store(true, std::memory_order_release);
+      USTDEX_TRY
+      {
+        _self_->_ctx_->_push_back(&_self_->_cancel_);
+      }
+      USTDEX_CATCH(...)
+      {
+        // Enqueuing only fails if locking the mutex fails, in which case the
+        // context is unusable anyway. The wait completes when the event fires.
+      }
+    }
+  };
+
+  using _stop_tok_t      = stop_token_of_t<env_of_t<Rcvr>>;
+  using _stop_callback_t = stop_callback_for_t<_stop_tok_t, _on_stop_t>;
+
+  struct _cancel_task : _task
+  {
+    USTDEX_API explicit _cancel_task(_wait_op* _self) noexcept
+        : _task{this, &_execute_impl}
+        , _self_{_self}
+    {}
+
+    USTDEX_API static void _execute_impl(_task* _p) noexcept
+    {
+      static_cast<_cancel_task*>(_p)->_self_->_cancel();
+    }
+
+    _wait_op* _self_;
+  };
+
+  USTDEX_API _wait_op(epoll_context* _ctx, _arg_t _arg, Rcvr _rcvr)
+      : _task{this, &_register_impl}
+      , _ctx_{_ctx}
+      , _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+      , _arg_{_arg}
+      , _cancel_{this}
+  {}
+
+  USTDEX_IMMOVABLE(_wait_op);
+
+  USTDEX_API void start() & noexcept
+  {
+    USTDEX_TRY
+    {
+      _ctx_->_push_back(this);
+    }
+    USTDEX_CATCH(...)
+    {
+      set_error(static_cast<Rcvr&&>(_rcvr_), std::make_error_code(std::errc::resource_unavailable_try_again));
+    }
+  }
+
+private:
+  USTDEX_API static void _register_impl(_task* _p) noexcept
+  {
+    static_cast<_wait_op*>(_p)->_register();
+  }
+
+  USTDEX_API static void _ready_impl(_task* _p) noexcept
+  {
+    static_cast<_wait_op*>(_p)->_ready();
+  }
+
+  USTDEX_API void _register() noexcept
+  {
+    auto _token = get_stop_token(get_env(_rcvr_));
+    if (_token.stop_requested())
+    {
+      set_stopped(static_cast<Rcvr&&>(_rcvr_));
+      return;
+    }
+
+    _fd_ = Kind::_open(_arg_);
+    if (_fd_ < 0)
+    {
+      set_error(static_cast<Rcvr&&>(_rcvr_), _last_error());
+      return;
+    }
+
+    // From now on, the readiness of the descriptor dispatches to _ready.
+    _execute_fn_ = &_ready_impl;
+
+    ::epoll_event _evt{};
+    _evt.events   = EPOLLIN | EPOLLONESHOT;
+    _evt.data.ptr = static_cast<_task*>(this);
+    if (::epoll_ctl(_ctx_->_epoll_fd_, EPOLL_CTL_ADD, _fd_, &_evt) != 0)
+    {
+      _fail(_last_error());
+      return;
+    }
+
+    // If stop has already been requested, this enqueues the cancellation.
+    _arm_on_stop(_token);
+  }
+
+  USTDEX_API void _ready() noexcept
+  {
+    // Wait for a concurrently executing stop callback to finish.
+    _disarm_on_stop();
+    if (_stop_requested_.load(std::memory_order_acquire))
+    {
+      // The cancellation task is in the queue and will complete the operation.
+      return;
+    }
+
+    _value_t _value;
+    if (int _err = Kind::_read(_fd_, _value); _err == EAGAIN)
+    {
+      // Someone else consumed the event. Rearm and keep waiting.
+      _arm_on_stop(get_stop_token(get_env(_rcvr_)));
+      ::epoll_event _evt{};
+      _evt.events   = EPOLLIN | EPOLLONESHOT;
+      _evt.data.ptr = static_cast<_task*>(this);
+      ::epoll_ctl(_ctx_->_epoll_fd_, EPOLL_CTL_MOD, _fd_, &_evt);
+    }
+    else if (_err != 0)
+    {
+      _fail(std::error_code{_err, std::system_category()});
+    }
+    else
+    {
+      _close();
+      set_value(static_cast<Rcvr&&>(_rcvr_), _value);
+    }
+  }
+
+  USTDEX_API void _cancel() noexcept
+  {
+    ::epoll_ctl(_ctx_->_epoll_fd_, EPOLL_CTL_DEL, _fd_, nullptr);
+    // _ready may have destroyed the callback already, if the descriptor
+    // became ready before this task ran.
+    _disarm_on_stop();
+    _close();
+    set_stopped(static_cast<Rcvr&&>(_rcvr_));
+  }
+
+  USTDEX_API void _arm_on_stop(_stop_tok_t _token) noexcept
+  {
+    _on_stop_.construct(static_cast<_stop_tok_t&&>(_token), _on_stop_t{this});
+    _has_on_stop_ = true;
+  }
+
+  USTDEX_API void _disarm_on_stop() noexcept
+  {
+    if (ustdex::_exchange(_has_on_stop_, false))
+    {
+      _on_stop_.destroy();
+    }
+  }
+
+  USTDEX_API void _fail(std::error_code _err) noexcept
+  {
+    _close();
+    set_error(static_cast<Rcvr&&>(_rcvr_), _err);
+  }
+
+  USTDEX_API void _close() noexcept
+  {
+    ::close(ustdex::_exchange(_fd_, -1));
+  }
+
+  epoll_context* _ctx_;
+  Rcvr _rcvr_;
+  _arg_t _arg_;
+  int _fd_ = -1;
+  std::atomic<bool> _stop_requested_{false};
+  bool _has_on_stop_ = false; // only accessed on the context's thread
+  _cancel_task _cancel_;
+  _lazy<_stop_callback_t> _on_stop_;
+};
+} // namespace _epoll
+
+template <class Kind>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT _wait_sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class Self, class... Env>
+  USTDEX_API static constexpr auto get_completion_signatures() noexcept
+  {
+    return completion_signatures<set_value_t(typename Kind::_value_t), set_error_t(std::error_code), set_stopped_t()>();
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) const noexcept -> _epoll::_wait_op<Rcvr, Kind>
+  {
+    return _epoll::_wait_op<Rcvr, Kind>{_sch_._ctx_, _arg_, static_cast<Rcvr&&>(_rcvr)};
+  }
+
+  epoll_context::_scheduler _sch_;
+  typename Kind::_arg_t _arg_;
+};
+
+//! \brief Returns a sender that completes on the context's thread with the
+//! `signalfd_siginfo` of the next occurrence of signal `signo`.
+//!
+//! \c signo must be blocked in all threads of the process.
+inline constexpr struct async_wait_signal_t
+{
+  USTDEX_API auto operator()(epoll_context::_scheduler _sch, int _signo) const noexcept
+    -> _wait_sndr_t<_epoll::_signal_kind>
+  {
+    return _wait_sndr_t<_epoll::_signal_kind>{_sch, _signo};
+  }
+} async_wait_signal{};
+
+//! \brief Returns a sender that completes on the context's thread with the
+//! `siginfo_t` of child process `pid` once it has exited. The child is reaped.
+inline constexpr struct async_wait_child_t
+{
+  USTDEX_API auto operator()(epoll_context::_scheduler _sch, ::pid_t _pid) const noexcept
+    -> _wait_sndr_t<_epoll::_child_kind>
+  {
+    return _wait_sndr_t<_epoll::_child_kind>{_sch, _pid};
+  }
+} async_wait_child{};
+
+USTDEX_API inline void epoll_context::run()
+{
+  ::epoll_event _events[64];
+  for (;;)
+  {
+    for (_task* _tsk = _pop_all(); _tsk != nullptr;)
+    {
+      _task* _next = _tsk->_next_;
+      _tsk->_execute();
+      _tsk = _next;
+    }
+
+    {
+      std::unique_lock _lock{_mutex_};
+      if (_stop_ && _head_._next_ == &_head_)
+      {
+        return;
+      }
+    }
+
+    int _count = ::epoll_wait(_epoll_fd_, _events, 64, -1);
+    for (int _i = 0; _i < _count; ++_i)
+    {
+      if (_events[_i].data.ptr == nullptr)
+      {
+        ::eventfd_t _ignored;
+        ::eventfd_read(_event_fd_, &_ignored);
+      }
+      else
+      {
+        static_cast<_task*>(_events[_i].data.ptr)->_execute();
+      }
+    }
+  }
+}
+
+USTDEX_API inline void epoll_context::finish()
+{
+  {
+    std::unique_lock _lock{_mutex_};
+    _stop_ = true;
+  }
+  _wakeup();
+}
+
+USTDEX_API inline void epoll_context::_push_back(_task* _tsk)
+{
+  {
+    std::unique_lock _lock{_mutex_};
+    _tsk->_next_ = &_head_;
+    _head_._tail_ = _head_._tail_->_next_ = _tsk;
+  }
+  _wakeup();
+}
+
+// Detaches the whole queue and returns it as a null-terminated list.
+USTDEX_API inline auto epoll_context::_pop_all() -> _task*
+{
+  std::unique_lock _lock{_mutex_};
+  if (_head_._next_ == &_head_)
+  {
+    return nullptr;
+  }
+  _task* _first         = _head_._next_;
+  _head_._tail_->_next_ = nullptr;
+  _head_._next_         = _head_._tail_ = &_head_;
+  return _first;
+}
+
+USTDEX_API inline void epoll_context::_wakeup() noexcept
+{
+  ::eventfd_write(_event_fd_, 1);
+}
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // defined(__linux__) && !defined(__CUDA_ARCH__)
+
+#endif
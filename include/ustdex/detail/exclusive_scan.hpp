@@ -19,19 +19,17 @@
 
 #include "config.hpp"
 
-#include <algorithm>  // IWYU pragma: keep
 #include <functional> // IWYU pragma: keep
-#include <numeric>    // IWYU pragma: keep
+#include <iterator>   // IWYU pragma: keep
 
 namespace ustdex
 {
-#if __cplusplus >= 202002L
-// exclusive_scan is constexpr in C++20
-using std::exclusive_scan;
-#else
+// Serial scans that are usable in constant expressions, like the C++20
+// std::exclusive_scan and std::inclusive_scan. They also serve as the per-chunk
+// kernels of the parallel scan algorithms.
 template <class InputIterator, class OutputIterator, class Tp, class BinaryOp>
 USTDEX_API constexpr OutputIterator
-exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, Tp init, BinaryOp b)
+_exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, Tp init, BinaryOp b)
 {
   if (first != last)
   {
@@ -54,9 +52,33 @@ exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, T
 
 template <class InputIterator, class OutputIterator, class Tp>
 USTDEX_API constexpr OutputIterator
-exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, Tp init)
+_exclusive_scan(InputIterator first, InputIterator last, OutputIterator result, Tp init)
 {
-  return ustdex::exclusive_scan(first, last, result, init, std::plus<>());
+  return ustdex::_exclusive_scan(first, last, result, init, std::plus<>());
+}
+
+template <class InputIterator, class OutputIterator, class BinaryOp, class Tp>
+USTDEX_API constexpr OutputIterator
+_inclusive_scan(InputIterator first, InputIterator last, OutputIterator result, BinaryOp b, Tp init)
+{
+  for (; first != last; ++first, (void) ++result)
+  {
+    init    = b(static_cast<Tp&&>(init), *first);
+    *result = init;
+  }
+  return result;
+}
+
+template <class InputIterator, class OutputIterator, class BinaryOp>
+USTDEX_API constexpr OutputIterator
+_inclusive_scan(InputIterator first, InputIterator last, OutputIterator result, BinaryOp b)
+{
+  if (first != last)
+  {
+    typename std::iterator_traits<InputIterator>::value_type init(*first);
+    *result = init;
+    return ustdex::_inclusive_scan(++first, last, ++result, b, static_cast<decltype(init)&&>(init));
+  }
+  return result;
 }
-#endif
 } // namespace ustdex
@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_INTO_VARIANT
+#define USTDEX_DETAIL_INTO_VARIANT
+
+#include "completion_signatures.hpp"
+#include "concepts.hpp"
+#include "cpos.hpp"
+#include "exception.hpp"
+#include "meta.hpp"
+#include "rcvr_ref.hpp"
+#include "trace.hpp"
+
+#include <tuple>
+#include <variant>
+
+#include "prologue.hpp"
+
+namespace ustdex
+{
+template <class... Ts>
+using _decayed_std_tuple = std::tuple<USTDEX_DECAY(Ts)...>;
+
+// The type that into_variant sends, and that sync_wait_with_variant returns:
+// a variant of one tuple of decayed values per value completion.
+template <class Completions>
+using _std_variant_of = _value_types<Completions, _decayed_std_tuple, std::variant>;
+
+// The index of the first alternative of a variant that has type Ty. Several
+// value completions can decay to the same tuple.
+template <class Ty, class... Ts>
+USTDEX_API constexpr auto _std_variant_index(std::variant<Ts...>*) noexcept -> std::size_t
+{
+  constexpr bool _same[] = {USTDEX_IS_SAME(Ty, Ts)...};
+  return ustdex::_find_pos(_same, _same + sizeof...(Ts));
+}
+
+struct into_variant_t
+{
+private:
+  template <class Rcvr, class CvSndr>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using _env_t                  = FWD_ENV_T<env_of_t<Rcvr>>;
+    using _variant_t              = _std_variant_of<completion_signatures_of_t<CvSndr, _env_t>>;
+
+    USTDEX_API _opstate_t(CvSndr&& _sndr, Rcvr _rcvr)
+        : _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+        , _opstate_{ustdex::connect(static_cast<CvSndr&&>(_sndr), _rcvr_ref{*this})}
+    {}
+
+    USTDEX_IMMOVABLE(_opstate_t);
+
+    USTDEX_API void start() & noexcept
+    {
+      ustdex::_trace_start(_rcvr_);
+      ustdex::start(_opstate_);
+    }
+
+    template <class... As>
+    USTDEX_API void set_value(As&&... _as) noexcept
+    {
+      constexpr std::size_t _index =
+        ustdex::_std_variant_index<_decayed_std_tuple<As...>>(static_cast<_variant_t*>(nullptr));
+      if constexpr (_nothrow_decay_copyable<As...>)
+      {
+        ustdex::set_value(static_cast<Rcvr&&>(_rcvr_),
+                          _variant_t{std::in_place_index<_index>, static_cast<As&&>(_as)...});
+      }
+      else
+      {
+        USTDEX_TRY
+        {
+          ustdex::set_value(static_cast<Rcvr&&>(_rcvr_),
+                            _variant_t{std::in_place_index<_index>, static_cast<As&&>(_as)...});
+        }
+        USTDEX_CATCH(...)
+        {
+          ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+        }
+      }
+    }
+
+    template <class Error>
+    USTDEX_API void set_error(Error&& _error) noexcept
+    {
+      ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), static_cast<Error&&>(_error));
+    }
+
+    USTDEX_API void set_stopped() noexcept
+    {
+      ustdex::set_stopped(static_cast<Rcvr&&>(_rcvr_));
+    }
+
+    USTDEX_API auto get_env() const noexcept -> _env_t
+    {
+      return ustdex::get_env(_rcvr_);
+    }
+
+    Rcvr _rcvr_;
+    connect_result_t<CvSndr, _rcvr_ref<_opstate_t, _env_t>> _opstate_;
+  };
+
+  template <class Sndr>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _sndr_t;
+
+  struct _closure_t
+  {
+    template <class Sndr>
+    USTDEX_TRIVIAL_API auto operator()(Sndr _sndr) const -> _call_result_t<into_variant_t, Sndr>
+    {
+      return into_variant_t()(static_cast<Sndr&&>(_sndr));
+    }
+
+    template <class Sndr>
+    USTDEX_TRIVIAL_API friend auto operator|(Sndr _sndr, _closure_t) -> _call_result_t<into_variant_t, Sndr>
+    {
+      return into_variant_t()(static_cast<Sndr&&>(_sndr));
+    }
+  };
+
+public:
+  //! \brief Adapts a sender that may complete successfully in several ways
+  //! into one that has a single value completion. It sends a `std::variant`
+  //! with one `std::tuple` of decayed values per value completion of the
+  //! child, constructed in place from the child's values.
+  template <class Sndr>
+  USTDEX_TRIVIAL_API auto operator()(Sndr _sndr) const noexcept -> _sndr_t<Sndr>;
+
+  USTDEX_TRIVIAL_API auto operator()() const noexcept -> _closure_t
+  {
+    return {};
+  }
+};
+
+template <class Sndr>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT into_variant_t::_sndr_t
+{
+  using sender_concept = sender_t;
+  USTDEX_NO_UNIQUE_ADDRESS into_variant_t _tag_;
+  Sndr _sndr_;
+
+  template <class Self, class... Env>
+  USTDEX_API static constexpr auto get_completion_signatures()
+  {
+    USTDEX_LET(auto _child_completions = get_child_completion_signatures<Self, Sndr, Env...>())
+    {
+      using _completions = decltype(_child_completions);
+      auto _others       = transform_completion_signatures(_child_completions, _swallow_transform());
+      if constexpr (_child_completions.count(set_value) == 0)
+      {
+        return _others;
+      }
+      else
+      {
+        constexpr bool _nothrow = _partitioned_completions_of<_completions>::_nothrow_decay_copyable::_values::value;
+        return _others + completion_signatures<set_value_t(_std_variant_of<_completions>)>()
+             + _eptr_completion_if<!_nothrow>();
+      }
+    }
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) && //
+    noexcept(_nothrow_constructible<_opstate_t<_traced_rcvr_t<into_variant_t, Rcvr>, Sndr>,
+                                    Sndr,
+                                    _traced_rcvr_t<into_variant_t, Rcvr>>) //
+    -> _opstate_t<_traced_rcvr_t<into_variant_t, Rcvr>, Sndr>
+  {
+    return _opstate_t<_traced_rcvr_t<into_variant_t, Rcvr>, Sndr>{
+      static_cast<Sndr&&>(_sndr_), ustdex::_trace_rcvr<into_variant_t>(static_cast<Rcvr&&>(_rcvr))};
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) const& //
+    noexcept(_nothrow_constructible<_opstate_t<_traced_rcvr_t<into_variant_t, Rcvr>, const Sndr&>,
+                                    const Sndr&,
+                                    _traced_rcvr_t<into_variant_t, Rcvr>>) //
+    -> _opstate_t<_traced_rcvr_t<into_variant_t, Rcvr>, const Sndr&>
+  {
+    return _opstate_t<_traced_rcvr_t<into_variant_t, Rcvr>, const Sndr&>{
+      _sndr_, ustdex::_trace_rcvr<into_variant_t>(static_cast<Rcvr&&>(_rcvr))};
+  }
+
+  USTDEX_API env_of_t<Sndr> get_env() const noexcept
+  {
+    return ustdex::get_env(_sndr_);
+  }
+};
+
+template <class Sndr>
+USTDEX_TRIVIAL_API auto into_variant_t::operator()(Sndr _sndr) const noexcept -> _sndr_t<Sndr>
+{
+  // If the incoming sender is non-dependent, we can check the completion
+  // signatures of the composed sender immediately.
+  if constexpr (!dependent_sender<Sndr>)
+  {
+    using _completions = completion_signatures_of_t<_sndr_t<Sndr>>;
+    static_assert(_valid_completion_signatures<_completions>);
+  }
+  return _sndr_t<Sndr>{{}, static_cast<Sndr&&>(_sndr)};
+}
+
+inline constexpr into_variant_t into_variant{};
+
+template <>
+inline constexpr const char* trace_name_v<into_variant_t> = "into_variant";
+} // namespace ustdex
+
+#include "epilogue.hpp"
+
+#endif
@@ -23,11 +23,16 @@
 #include "config.hpp"
 #include "cpos.hpp"
 #include "exception.hpp"
+#include "queries.hpp"
 #include "rcvr_ref.hpp"
+#include "trace.hpp"
 #include "tuple.hpp"
 #include "type_traits.hpp"
 #include "variant.hpp"
 
+#include <memory>
+#include <optional>
+
 #include "prologue.hpp"
 
 namespace ustdex
@@ -86,6 +91,72 @@ private:
                                   _opstate_fn<Fn, Rcvr>::template call,
                                   _variant>;
 
+  //! \brief Holds the second operation state in storage obtained from the
+  //! environment's allocator when the function is called. Used in place of
+  //! the variant of operation states when the environment opts in with
+  //! `allocate_let_opstate`, so that the parent operation state does not
+  //! reserve room for a continuation that may never run.
+  template <class Env>
+  struct _alloc_opstate_t
+  {
+    using _alloc_t = USTDEX_DECAY(_call_result_t<get_allocator_t, const Env&>);
+
+    template <class Ty>
+    using _traits_t = typename std::allocator_traits<_alloc_t>::template rebind_traits<Ty>;
+
+    template <class Ty>
+    USTDEX_API static void _destroy_at(_alloc_t& _alloc, void* _ptr) noexcept
+    {
+      typename _traits_t<Ty>::allocator_type _alloc2(_alloc);
+      std::destroy_at(static_cast<Ty*>(_ptr));
+      _traits_t<Ty>::deallocate(_alloc2, static_cast<Ty*>(_ptr), 1);
+    }
+
+    USTDEX_API _alloc_opstate_t() noexcept {}
+
+    USTDEX_IMMOVABLE(_alloc_opstate_t);
+
+    USTDEX_API ~_alloc_opstate_t()
+    {
+      _reset();
+    }
+
+    USTDEX_API void _reset() noexcept
+    {
+      if (_ptr_ != nullptr)
+      {
+        _destroy_(*_alloc_, ustdex::_exchange(_ptr_, nullptr));
+        _alloc_.reset();
+      }
+    }
+
+    template <class Fn, class... As>
+    USTDEX_API auto _emplace_from(const _alloc_t& _alloc, Fn&& _fn, As&&... _as) -> _call_result_t<Fn, As...>&
+    {
+      using _result_t = _call_result_t<Fn, As...>;
+      _reset();
+      typename _traits_t<_result_t>::allocator_type _alloc2(_alloc);
+      _result_t* _value = _traits_t<_result_t>::allocate(_alloc2, 1);
+      USTDEX_TRY
+      {
+        ::new (static_cast<void*>(_value)) _result_t(static_cast<Fn&&>(_fn)(static_cast<As&&>(_as)...));
+      }
+      USTDEX_CATCH(...)
+      {
+        _traits_t<_result_t>::deallocate(_alloc2, _value, 1);
+        USTDEX_THROW();
+      }
+      _alloc_.emplace(_alloc);
+      _destroy_ = &_destroy_at<_result_t>;
+      _ptr_     = _value;
+      return *_value;
+    }
+
+    void* _ptr_ = nullptr;
+    void (*_destroy_)(_alloc_t&, void*) noexcept = nullptr;
+    std::optional<_alloc_t> _alloc_;
+  };
+
   //! \brief The `let_(value|error|stopped)` operation state.
   //! \tparam CvSndr The cvref-qualified predecessor sender type.
   //! \tparam Fn The function to be called when the predecessor sender
@@ -98,8 +169,10 @@ private:
     using operation_state_concept = operation_state_t;
     using _env_t                  = FWD_ENV_T<env_of_t<Rcvr>>;
 
-    // Compute the type of the variant of operation states
-    using _opstate_variant_t = _opstate2_t<CvSndr, Fn, Rcvr>;
+    // Compute the type of the variant of operation states, unless the
+    // environment asks for the second operation state to be allocated.
+    static constexpr bool _allocates = USTDEX_DECAY(_call_result_t<allocate_let_opstate_t, const _env_t&>)::value;
+    using _opstate_variant_t = _m_if<_allocates, _alloc_opstate_t<_env_t>, _opstate2_t<CvSndr, Fn, Rcvr>>;
 
     USTDEX_API _opstate_t(CvSndr&& _sndr, Fn _fn, Rcvr _rcvr) noexcept(
       _nothrow_decay_copyable<Fn, Rcvr> && _nothrow_connectable<CvSndr, _opstate_t*>)
@@ -110,6 +183,7 @@ private:
 
     USTDEX_API void start() noexcept
     {
+      ustdex::_trace_start(_rcvr_);
       ustdex::start(_opstate1_);
     }
 
@@ -125,8 +199,8 @@ private:
           auto& _tupl = _result_.template _emplace<_decayed_tuple<As...>>(static_cast<As&&>(_as)...);
           // Call the function with the results and connect the resulting
           // sender, storing the operation state in _opstate2_.
-          auto& _next_op = _opstate2_._emplace_from(
-            ustdex::connect, _tupl.apply(static_cast<Fn&&>(_fn_), _tupl), ustdex::_rcvr_ref{_rcvr_});
+          auto& _next_op = _emplace_opstate2(
+            ustdex::connect, _tupl.apply(static_cast<Fn&&>(_fn_), _tupl), ustdex::_rcvr_ref<Rcvr>{_rcvr_});
           ustdex::start(_next_op);
         }
         USTDEX_CATCH_ALL
@@ -141,6 +215,19 @@ private:
       }
     }
 
+    template <class... As>
+    USTDEX_API auto& _emplace_opstate2(As&&... _as)
+    {
+      if constexpr (_allocates)
+      {
+        return _opstate2_._emplace_from(ustdex::get_allocator(ustdex::get_env(_rcvr_)), static_cast<As&&>(_as)...);
+      }
+      else
+      {
+        return _opstate2_._emplace_from(static_cast<As&&>(_as)...);
+      }
+    }
+
     template <class... As>
     USTDEX_TRIVIAL_API void set_value(As&&... _as) noexcept
     {
@@ -246,22 +333,29 @@ private:
     }
 
     template <class Rcvr>
-    USTDEX_API auto connect(Rcvr _rcvr) && noexcept(_nothrow_constructible<_opstate_t<Rcvr, Sndr, Fn>, Sndr, Fn, Rcvr>)
-      -> _opstate_t<Rcvr, Sndr, Fn>
+    USTDEX_API auto connect(Rcvr _rcvr) && noexcept( //
+      _nothrow_constructible<_opstate_t<_traced_rcvr_t<LetTag, Rcvr>, Sndr, Fn>,
+                             Sndr,
+                             Fn,
+                             _traced_rcvr_t<LetTag, Rcvr>>) //
+      -> _opstate_t<_traced_rcvr_t<LetTag, Rcvr>, Sndr, Fn>
     {
-      return _opstate_t<Rcvr, Sndr, Fn>(
-        static_cast<Sndr&&>(_sndr_), static_cast<Fn&&>(_fn_), static_cast<Rcvr&&>(_rcvr));
+      return _opstate_t<_traced_rcvr_t<LetTag, Rcvr>, Sndr, Fn>(
+        static_cast<Sndr&&>(_sndr_),
+        static_cast<Fn&&>(_fn_),
+        ustdex::_trace_rcvr<LetTag>(static_cast<Rcvr&&>(_rcvr)));
     }
 
     template <class Rcvr>
     USTDEX_API auto connect(Rcvr _rcvr) const& noexcept( //
-      _nothrow_constructible<_opstate_t<Rcvr, const Sndr&, Fn>,
+      _nothrow_constructible<_opstate_t<_traced_rcvr_t<LetTag, Rcvr>, const Sndr&, Fn>,
                              const Sndr&,
                              const Fn&,
-                             Rcvr>) //
-      -> _opstate_t<Rcvr, const Sndr&, Fn>
+                             _traced_rcvr_t<LetTag, Rcvr>>) //
+      -> _opstate_t<_traced_rcvr_t<LetTag, Rcvr>, const Sndr&, Fn>
     {
-      return _opstate_t<Rcvr, const Sndr&, Fn>(_sndr_, _fn_, static_cast<Rcvr&&>(_rcvr));
+      return _opstate_t<_traced_rcvr_t<LetTag, Rcvr>, const Sndr&, Fn>(
+        _sndr_, _fn_, ustdex::_trace_rcvr<LetTag>(static_cast<Rcvr&&>(_rcvr)));
     }
 
     USTDEX_API env_of_t<Sndr> get_env() const noexcept
@@ -323,6 +417,13 @@ inline constexpr struct let_error_t : _let<_error>
 inline constexpr struct let_stopped_t : _let<_stopped>
 {
 } let_stopped{};
+
+template <>
+inline constexpr const char* trace_name_v<let_value_t> = "let_value";
+template <>
+inline constexpr const char* trace_name_v<let_error_t> = "let_error";
+template <>
+inline constexpr const char* trace_name_v<let_stopped_t> = "let_stopped";
 } // namespace ustdex
 
 #include "epilogue.hpp"
@@ -0,0 +1,232 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_LOCK_PROFILE
+#define USTDEX_DETAIL_LOCK_PROFILE
+
+#include "config.hpp"
+
+#if USTDEX_LOCK_PROFILING()
+
+#  include <algorithm>
+#  include <atomic>
+#  include <chrono>
+#  include <cinttypes>
+#  include <cstdint>
+#  include <cstdio>
+#  include <cstring>
+#  include <mutex>
+#  include <string>
+#  include <vector>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+//! \brief The contention counters of one lock, or of all the destroyed locks
+//! of one kind.
+struct lock_stats
+{
+  //! The type that owns the lock, e.g. "run_loop".
+  const char* kind = "";
+  //! The object that owns the lock, or null for destroyed locks.
+  const void* owner = nullptr;
+  //! The number of locks these counters add up: 1 for a live lock.
+  std::uint64_t instances = 1;
+  std::uint64_t acquisitions = 0;
+  //! The acquisitions that found the lock held by another thread.
+  std::uint64_t contended = 0;
+  //! The number of times a spin lock waited for its holder to release it.
+  std::uint64_t spins = 0;
+  //! The total time that contended acquisitions waited for the lock.
+  std::chrono::nanoseconds blocked{0};
+};
+
+// The counters that a profiled lock updates. Each one registers itself in a
+// global list so that `get_lock_stats` can find it, and folds its counters
+// into a per-kind total when it is destroyed.
+class _lock_profile
+{
+public:
+  USTDEX_API _lock_profile(const char* _kind, const void* _owner) noexcept
+      : _kind_(_kind)
+      , _owner_(_owner)
+  {
+    auto& _reg = _registry::_get();
+    std::lock_guard _lock{_reg._mutex_};
+    _next_ = _reg._head_;
+    if (_next_ != nullptr)
+    {
+      _next_->_prev_ = this;
+    }
+    _reg._head_ = this;
+  }
+
+  _lock_profile(_lock_profile&&) = delete;
+
+  USTDEX_API ~_lock_profile()
+  {
+    auto& _reg = _registry::_get();
+    std::lock_guard _lock{_reg._mutex_};
+    (_prev_ != nullptr ? _prev_->_next_ : _reg._head_) = _next_;
+    if (_next_ != nullptr)
+    {
+      _next_->_prev_ = _prev_;
+    }
+    _reg._retire(_stats());
+  }
+
+  //! Records one acquisition of the lock.
+  USTDEX_API void _record(bool _contended, std::uint64_t _spins, std::chrono::nanoseconds _blocked) noexcept
+  {
+    _acquisitions_.fetch_add(1, std::memory_order_relaxed);
+    if (_contended)
+    {
+      _contended_.fetch_add(1, std::memory_order_relaxed);
+      _spins_.fetch_add(_spins, std::memory_order_relaxed);
+      _blocked_ns_.fetch_add(static_cast<std::uint64_t>(_blocked.count()), std::memory_order_relaxed);
+    }
+  }
+
+  USTDEX_API auto _stats() const noexcept -> lock_stats
+  {
+    lock_stats _out;
+    _out.kind         = _kind_;
+    _out.owner        = _owner_;
+    _out.acquisitions = _acquisitions_.load(std::memory_order_relaxed);
+    _out.contended    = _contended_.load(std::memory_order_relaxed);
+    _out.spins        = _spins_.load(std::memory_order_relaxed);
+    _out.blocked      = std::chrono::nanoseconds(_blocked_ns_.load(std::memory_order_relaxed));
+    return _out;
+  }
+
+private:
+  friend auto get_lock_stats() -> std::vector<lock_stats>;
+
+  struct _registry
+  {
+    USTDEX_API static auto _get() noexcept -> _registry&
+    {
+      static _registry _reg;
+      return _reg;
+    }
+
+    USTDEX_API void _retire(const lock_stats& _stats)
+    {
+      for (auto& _total : _retired_)
+      {
+        if (std::strcmp(_total.kind, _stats.kind) == 0)
+        {
+          _total.instances += 1;
+          _total.acquisitions += _stats.acquisitions;
+          _total.contended += _stats.contended;
+          _total.spins += _stats.spins;
+          _total.blocked += _stats.blocked;
+          return;
+        }
+      }
+      _retired_.push_back(_stats);
+      _retired_.back().owner = nullptr;
+    }
+
+    std::mutex _mutex_;
+    _lock_profile* _head_ = nullptr;
+    std::vector<lock_stats> _retired_;
+  };
+
+  const char* _kind_;
+  const void* _owner_;
+  _lock_profile* _next_ = nullptr;
+  _lock_profile* _prev_ = nullptr;
+  std::atomic<std::uint64_t> _acquisitions_{0};
+  std::atomic<std::uint64_t> _contended_{0};
+  std::atomic<std::uint64_t> _spins_{0};
+  std::atomic<std::uint64_t> _blocked_ns_{0};
+};
+
+//! \brief Returns the counters of every live profiled lock, followed by one
+//! total for the destroyed locks of each kind. Only available when built with
+//! `USTDEX_ENABLE_LOCK_PROFILING`.
+USTDEX_API inline auto get_lock_stats() -> std::vector<lock_stats>
+{
+  auto& _reg = _lock_profile::_registry::_get();
+  std::lock_guard _lock{_reg._mutex_};
+  std::vector<lock_stats> _out;
+  for (auto* _prof = _reg._head_; _prof != nullptr; _prof = _prof->_next_)
+  {
+    _out.push_back(_prof->_stats());
+  }
+  _out.insert(_out.end(), _reg._retired_.begin(), _reg._retired_.end());
+  return _out;
+}
+
+//! \brief Formats `get_lock_stats()` as a table, one lock per line, with the
+//! most contended locks first.
+USTDEX_API inline auto lock_stats_report() -> std::string
+{
+  auto _stats = get_lock_stats();
+  std::stable_sort(_stats.begin(), _stats.end(), [](const lock_stats& _a, const lock_stats& _b) {
+    return _a.contended > _b.contended;
+  });
+
+  std::string _out;
+  char _line[192];
+  std::snprintf(_line,
+                sizeof(_line),
+                "%-20s %-18s %14s %12s %10s %12s %14s\n",
+                "kind",
+                "owner",
+                "acquisitions",
+                "contended",
+                "contended%",
+                "spins",
+                "blocked (us)");
+  _out += _line;
+  for (auto& _st : _stats)
+  {
+    char _owner[32];
+    if (_st.owner != nullptr)
+    {
+      std::snprintf(_owner, sizeof(_owner), "%p", _st.owner);
+    }
+    else
+    {
+      std::snprintf(_owner, sizeof(_owner), "%" PRIu64 " destroyed", _st.instances);
+    }
+    const double _percent =
+      _st.acquisitions == 0 ? 0.0 : 100.0 * static_cast<double>(_st.contended) / static_cast<double>(_st.acquisitions);
+    std::snprintf(_line,
+                  sizeof(_line),
+                  "%-20s %-18s %14" PRIu64 " %12" PRIu64 " %9.2f%% %12" PRIu64 " %14.1f\n",
+                  _st.kind,
+                  _owner,
+                  _st.acquisitions,
+                  _st.contended,
+                  _percent,
+                  _st.spins,
+                  static_cast<double>(_st.blocked.count()) / 1e3);
+    _out += _line;
+  }
+  return _out;
+}
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // USTDEX_LOCK_PROFILING()
+
+#endif
@@ -596,29 +596,20 @@ struct _tupl<_Ty, _Ts...>
   }
 };
 
-template <bool _Empty>
-struct _bulk_insert
-{
-  template <class _Set, class...>
-  using call USTDEX_ATTR_NODEBUG_ALIAS = _Set;
-};
+// Insertion folds over operator%, which inserts one type into the set. Unlike
+// recursing on the list of types, each step only sees the set so far and the
+// next type. `_m_undefined` prevents the instantiation of the intermediate
+// wrapper types.
+template <class _Set, class _Ty>
+USTDEX_API auto operator%(_m_undefined<_Set>&, _m_undefined<_Ty>*)
+  -> _m_undefined<typename _Set::template _maybe_insert<_Ty>>&;
 
-template <>
-struct _bulk_insert<false>
-{
-#if USTDEX_MSVC() && _MSC_VER < 1920
-  template <class _Set, class _Ty, class... _Us>
-  USTDEX_API static auto _insert_fn(_m_list<_Ty, _Us...>*) ->
-    typename _bulk_insert<sizeof...(_Us) == 0>::template call<typename _Set::template _maybe_insert<_Ty>, _Us...>;
+template <class _Set>
+USTDEX_API auto _unpack(_m_undefined<_Set>&) -> _Set;
 
-  template <class _Set, class... _Us>
-  using call USTDEX_ATTR_NODEBUG_ALIAS = decltype(_insert_fn<_Set>(static_cast<_m_list<_Us...>*>(nullptr)));
-#else
-  template <class _Set, class _Ty, class... _Us>
-  using call USTDEX_ATTR_NODEBUG_ALIAS =
-    typename _bulk_insert<sizeof...(_Us) == 0>::template call<typename _Set::template _maybe_insert<_Ty>, _Us...>;
-#endif
-};
+template <class _Set, class... _Ts>
+using _insert USTDEX_ATTR_NODEBUG_ALIAS =
+  decltype(_set::_unpack((*static_cast<_m_undefined<_Set>*>(nullptr) % ... % static_cast<_m_undefined<_Ts>*>(nullptr))));
 } // namespace _set
 
 // When comparing sets for equality, use conjunction<> to short-circuit the set
@@ -634,7 +625,7 @@ template <class... _Ts>
 using _m_set = _set::_tupl<_Ts...>;
 
 template <class _Set, class... _Ts>
-using _m_set_insert = typename _set::_bulk_insert<sizeof...(_Ts) == 0>::template call<_Set, _Ts...>;
+using _m_set_insert = _set::_insert<_Set, _Ts...>;
 
 template <class... _Ts>
 using _m_make_set = _m_set_insert<_m_set<>, _Ts...>;
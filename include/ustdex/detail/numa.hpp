@@ -0,0 +1,226 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_NUMA
+#define USTDEX_DETAIL_NUMA
+
+#include "config.hpp"
+
+#if !defined(__CUDA_ARCH__)
+
+#  include "exception.hpp"
+
+#  include <algorithm>
+#  include <cstddef>
+#  include <fstream>
+#  include <string>
+#  include <thread>
+#  include <vector>
+
+#  if defined(__linux__)
+#    include <pthread.h>
+#    include <sched.h>
+#  endif
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+//! \brief A NUMA node and the CPUs that belong to it.
+struct numa_node
+{
+  std::size_t id;
+  std::vector<int> cpus;
+};
+
+//! \brief The NUMA nodes of the machine, restricted to the CPUs this process
+//! is allowed to run on.
+//!
+//! On Linux, the topology is read from `/sys/devices/system/node`. When that
+//! is not available (non-Linux hosts, containers without sysfs, machines
+//! without NUMA), the topology consists of a single node containing every CPU.
+struct numa_topology
+{
+  std::vector<numa_node> nodes;
+
+  USTDEX_API static auto discover() -> numa_topology;
+
+  USTDEX_API static auto single_node() -> numa_topology;
+
+  USTDEX_API auto cpu_count() const noexcept -> std::size_t
+  {
+    std::size_t _count = 0;
+    for (auto& _node : nodes)
+    {
+      _count += _node.cpus.size();
+    }
+    return _count;
+  }
+};
+
+namespace _numa
+{
+// Parses a sysfs cpu list such as "0-3,8,10-11". Returns an empty vector on
+// malformed input.
+USTDEX_API inline auto _parse_cpu_list(const std::string& _str) -> std::vector<int>
+{
+  std::vector<int> _cpus;
+  std::size_t _pos = 0;
+  while (_pos < _str.size() && _str[_pos] != '\n')
+  {
+    std::size_t _end = 0;
+    int _first       = 0;
+    int _last        = 0;
+    USTDEX_TRY
+    {
+      _first = _last = std::stoi(_str.substr(_pos), &_end);
+      _pos += _end;
+      if (_pos < _str.size() && _str[_pos] == '-')
+      {
+        _last = std::stoi(_str.substr(++_pos), &_end);
+        _pos += _end;
+      }
+    }
+    USTDEX_CATCH(...)
+    {
+      return {};
+    }
+    for (int _cpu = _first; _cpu <= _last; ++_cpu)
+    {
+      _cpus.push_back(_cpu);
+    }
+    if (_pos < _str.size() && _str[_pos] == ',')
+    {
+      ++_pos;
+    }
+  }
+  return _cpus;
+}
+
+USTDEX_API inline auto _read_line(const std::string& _path) -> std::string
+{
+  std::ifstream _file{_path};
+  std::string _line;
+  std::getline(_file, _line);
+  return _line;
+}
+
+// The CPUs the calling thread may run on, or an empty vector if unknown.
+USTDEX_API inline auto _allowed_cpus() -> std::vector<int>
+{
+  std::vector<int> _cpus;
+#  if defined(__linux__)
+  ::cpu_set_t _set;
+  CPU_ZERO(&_set);
+  if (::sched_getaffinity(0, sizeof(_set), &_set) == 0)
+  {
+    for (int _cpu = 0; _cpu < CPU_SETSIZE; ++_cpu)
+    {
+      if (CPU_ISSET(_cpu, &_set))
+      {
+        _cpus.push_back(_cpu);
+      }
+    }
+  }
+#  endif
+  return _cpus;
+}
+
+//! Restricts the calling thread to the given CPUs. Returns false if affinity
+//! is not supported on this platform or the request was rejected.
+USTDEX_API inline auto _set_this_thread_affinity(const std::vector<int>& _cpus) noexcept -> bool
+{
+#  if defined(__linux__)
+  if (_cpus.empty())
+  {
+    return false;
+  }
+  ::cpu_set_t _set;
+  CPU_ZERO(&_set);
+  for (int _cpu : _cpus)
+  {
+    if (_cpu >= 0 && _cpu < CPU_SETSIZE)
+    {
+      CPU_SET(_cpu, &_set);
+    }
+  }
+  return ::pthread_setaffinity_np(::pthread_self(), sizeof(_set), &_set) == 0;
+#  else
+  (void) _cpus;
+  return false;
+#  endif
+}
+} // namespace _numa
+
+USTDEX_API inline auto numa_topology::single_node() -> numa_topology
+{
+  std::vector<int> _cpus = _numa::_allowed_cpus();
+  if (_cpus.empty())
+  {
+    int _count = static_cast<int>((std::max)(1u, std::thread::hardware_concurrency()));
+    for (int _cpu = 0; _cpu < _count; ++_cpu)
+    {
+      _cpus.push_back(_cpu);
+    }
+  }
+  numa_topology _topo;
+  _topo.nodes.push_back(numa_node{0, static_cast<std::vector<int>&&>(_cpus)});
+  return _topo;
+}
+
+USTDEX_API inline auto numa_topology::discover() -> numa_topology
+{
+#  if defined(__linux__)
+  const std::string _root   = "/sys/devices/system/node/";
+  std::vector<int> _online  = _numa::_parse_cpu_list(_numa::_read_line(_root + "online"));
+  std::vector<int> _allowed = _numa::_allowed_cpus();
+
+  numa_topology _topo;
+  for (int _id : _online)
+  {
+    std::vector<int> _cpus =
+      _numa::_parse_cpu_list(_numa::_read_line(_root + "node" + std::to_string(_id) + "/cpulist"));
+    if (!_allowed.empty())
+    {
+      _cpus.erase(std::remove_if(_cpus.begin(),
+                                 _cpus.end(),
+                                 [&](int _cpu) {
+                                   return !std::binary_search(_allowed.begin(), _allowed.end(), _cpu);
+                                 }),
+                  _cpus.end());
+    }
+    // Memory-only nodes and nodes outside our cpuset have no CPUs to run on.
+    if (!_cpus.empty())
+    {
+      _topo.nodes.push_back(numa_node{static_cast<std::size_t>(_id), static_cast<std::vector<int>&&>(_cpus)});
+    }
+  }
+
+  if (!_topo.nodes.empty())
+  {
+    return _topo;
+  }
+#  endif
+  return single_node();
+}
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
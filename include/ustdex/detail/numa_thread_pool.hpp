@@ -0,0 +1,492 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_NUMA_THREAD_POOL
+#define USTDEX_DETAIL_NUMA_THREAD_POOL
+
+#include "config.hpp"
+
+#if !defined(__CUDA_ARCH__)
+
+#  include "completion_signatures.hpp"
+#  include "cpos.hpp"
+#  include "env.hpp"
+#  include "exception.hpp"
+#  include "numa.hpp"
+#  include "queries.hpp"
+#  include "run_loop.hpp"
+#  include "utility.hpp"
+
+#  include <atomic>
+#  include <condition_variable>
+#  include <memory>
+#  include <mutex>
+#  include <thread>
+#  include <vector>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+class numa_thread_pool;
+
+//! The value of the `get_numa_node` query for schedulers that are not bound to
+//! a particular node.
+inline constexpr std::size_t numa_any_node = ~std::size_t(0);
+
+namespace _numa
+{
+template <class Rcvr>
+struct _pool_op;
+
+// Identifies the pool and node of the calling worker thread, if any.
+struct _worker_info
+{
+  const numa_thread_pool* _pool_ = nullptr;
+  std::size_t _node_             = 0;
+};
+
+USTDEX_API inline auto _this_worker() noexcept -> _worker_info&
+{
+  static thread_local _worker_info _info{};
+  return _info;
+}
+
+// The domain of the pool's schedulers. The parallel algorithms split their
+// input into one chunk per worker that the scheduler can run work on.
+struct _domain
+{
+  template <class Sch>
+  USTDEX_API auto parallelism(const Sch& _sch) const noexcept -> std::size_t
+  {
+    return _sch._parallelism();
+  }
+};
+} // namespace _numa
+
+//! \brief A thread pool with one worker per CPU, one queue per NUMA node, and
+//! workers pinned to the CPUs of their node.
+//!
+//! Work scheduled through `get_scheduler(node)` is enqueued on that node's
+//! queue. Workers serve their own node's queue first and only take work from
+//! other nodes when their own queue is empty. When a node has no idle workers,
+//! enqueuing work wakes an idle worker of another node so that the work is not
+//! delayed.
+class USTDEX_TYPE_VISIBILITY_DEFAULT numa_thread_pool
+{
+  template <class>
+  friend struct _numa::_pool_op;
+
+public:
+  explicit numa_thread_pool(numa_topology _topo = numa_topology::discover())
+      : _topo_{static_cast<numa_topology&&>(_topo)}
+      , _queues_{new _node_queue[_topo_.nodes.size()]}
+  {
+    USTDEX_TRY
+    {
+      for (std::size_t _node = 0; _node < _topo_.nodes.size(); ++_node)
+      {
+        for (std::size_t _i = 0; _i < _topo_.nodes[_node].cpus.size(); ++_i)
+        {
+          _threads_.emplace_back([this, _node] {
+            _worker(_node);
+          });
+        }
+      }
+    }
+    USTDEX_CATCH(...)
+    {
+      join();
+      USTDEX_THROW();
+    }
+  }
+
+  ~numa_thread_pool() noexcept
+  {
+    join();
+  }
+
+  USTDEX_IMMOVABLE(numa_thread_pool);
+
+  //! Waits for all scheduled work to finish and joins the worker threads.
+  void join() noexcept
+  {
+    _stop_.store(true);
+    for (std::size_t _node = 0; _node < _topo_.nodes.size(); ++_node)
+    {
+      std::unique_lock _lock{_queues_[_node]._mutex_};
+      _queues_[_node]._cv_.notify_all();
+    }
+    for (auto& _thrd : _threads_)
+    {
+      if (_thrd.joinable())
+      {
+        _thrd.join();
+      }
+    }
+  }
+
+  auto topology() const noexcept -> const numa_topology&
+  {
+    return _topo_;
+  }
+
+  auto node_count() const noexcept -> std::size_t
+  {
+    return _topo_.nodes.size();
+  }
+
+  auto thread_count() const noexcept -> std::size_t
+  {
+    return _threads_.size();
+  }
+
+  class _scheduler
+  {
+    struct _schedule_task
+    {
+      using sender_concept = sender_t;
+
+      template <class Rcvr>
+      USTDEX_API auto connect(Rcvr _rcvr) const noexcept -> _numa::_pool_op<Rcvr>
+      {
+        return _numa::_pool_op<Rcvr>{_pool_, _node_, static_cast<Rcvr&&>(_rcvr)};
+      }
+
+      template <class Self>
+      USTDEX_API static constexpr auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_error_t(::std::exception_ptr), set_stopped_t()>();
+      }
+
+      struct _env
+      {
+        numa_thread_pool* _pool_;
+        std::size_t _node_;
+
+        template <class Tag>
+        USTDEX_API auto query(get_completion_scheduler_t<Tag>) const noexcept -> _scheduler
+        {
+          return _scheduler{_pool_, _node_};
+        }
+
+        USTDEX_API auto query(get_numa_node_t) const noexcept -> std::size_t
+        {
+          return _pool_->_node_id(_node_);
+        }
+      };
+
+      USTDEX_API auto get_env() const noexcept -> _env
+      {
+        return _env{_pool_, _node_};
+      }
+
+    private:
+      friend _scheduler;
+
+      USTDEX_API explicit _schedule_task(numa_thread_pool* _pool, std::size_t _node) noexcept
+          : _pool_(_pool)
+          , _node_(_node)
+      {}
+
+      numa_thread_pool* _pool_;
+      std::size_t _node_;
+    };
+
+    friend numa_thread_pool;
+    friend _numa::_domain;
+
+    USTDEX_API explicit _scheduler(numa_thread_pool* _pool, std::size_t _node) noexcept
+        : _pool_(_pool)
+        , _node_(_node)
+    {}
+
+    USTDEX_API auto _parallelism() const noexcept -> std::size_t
+    {
+      return _node_ == numa_any_node ? _pool_->thread_count() : _pool_->_topo_.nodes[_node_].cpus.size();
+    }
+
+    numa_thread_pool* _pool_;
+    std::size_t _node_;
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    [[nodiscard]] USTDEX_API auto schedule() const noexcept -> _schedule_task
+    {
+      return _schedule_task{_pool_, _node_};
+    }
+
+    USTDEX_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    //! Lets the parallel algorithms, like `reduce`, split their work over the
+    //! workers of the pool, or of the node the scheduler is bound to.
+    USTDEX_API auto query(get_domain_t) const noexcept -> _numa::_domain
+    {
+      return {};
+    }
+
+    //! Returns the operating system's number of the node this scheduler is
+    //! bound to, or `numa_any_node`.
+    USTDEX_API auto query(get_numa_node_t) const noexcept -> std::size_t
+    {
+      return _pool_->_node_id(_node_);
+    }
+
+    USTDEX_API friend bool operator==(const _scheduler& _a, const _scheduler& _b) noexcept
+    {
+      return _a._pool_ == _b._pool_ && _a._node_ == _b._node_;
+    }
+
+    USTDEX_API friend bool operator!=(const _scheduler& _a, const _scheduler& _b) noexcept
+    {
+      return !(_a == _b);
+    }
+  };
+
+  //! Returns a scheduler that is not bound to a node. Work scheduled from a
+  //! worker thread stays on that worker's node; work scheduled from other
+  //! threads is distributed over the nodes round-robin.
+  USTDEX_API auto get_scheduler() noexcept -> _scheduler
+  {
+    return _scheduler{this, numa_any_node};
+  }
+
+  //! Returns a scheduler bound to the node at index `_node` of `topology().nodes`.
+  USTDEX_API auto get_scheduler(std::size_t _node) noexcept -> _scheduler
+  {
+    USTDEX_ASSERT(_node < _topo_.nodes.size(), "NUMA node index out of range");
+    return _scheduler{this, _node};
+  }
+
+private:
+  USTDEX_API auto _node_id(std::size_t _node) const noexcept -> std::size_t
+  {
+    return _node == numa_any_node ? numa_any_node : _topo_.nodes[_node].id;
+  }
+
+  struct _node_queue
+  {
+    _node_queue() noexcept
+    {
+      _head_._next_ = _head_._tail_ = &_head_;
+    }
+
+    std::mutex _mutex_{};
+    std::condition_variable _cv_{};
+    _task _head_{};
+    std::atomic<std::size_t> _size_{0};
+    std::atomic<std::size_t> _idle_{0};
+  };
+
+  USTDEX_API void _push(std::size_t _node, _task* _tsk);
+  USTDEX_API auto _try_pop(std::size_t _node) -> _task*;
+  USTDEX_API auto _pop_or_wait(std::size_t _node) -> _task*;
+  USTDEX_API auto _has_work() const noexcept -> bool;
+  USTDEX_API void _worker(std::size_t _node) noexcept;
+
+  numa_topology _topo_;
+  std::unique_ptr<_node_queue[]> _queues_;
+  std::vector<std::thread> _threads_{};
+  std::atomic<bool> _stop_{false};
+  std::atomic<std::size_t> _next_node_{0};
+  std::atomic<std::size_t> _idle_{0}; // idle workers over all nodes
+};
+
+namespace _numa
+{
+template <class Rcvr>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT _pool_op : _task
+{
+  using operation_state_concept = operation_state_t;
+
+  USTDEX_API _pool_op(numa_thread_pool* _pool, std::size_t _node, Rcvr _rcvr)
+      : _task{this, &_execute_impl}
+      , _pool_{_pool}
+      , _node_{_node}
+      , _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+  {}
+
+  USTDEX_IMMOVABLE(_pool_op);
+
+  USTDEX_API static void _execute_impl(_task* _p) noexcept
+  {
+    auto& _rcvr = static_cast<_pool_op*>(_p)->_rcvr_;
+    if (get_stop_token(get_env(_rcvr)).stop_requested())
+    {
+      set_stopped(static_cast<Rcvr&&>(_rcvr));
+    }
+    else
+    {
+      set_value(static_cast<Rcvr&&>(_rcvr));
+    }
+  }
+
+  USTDEX_API void start() & noexcept
+  {
+    USTDEX_TRY
+    {
+      _pool_->_push(_node_, this);
+    }
+    USTDEX_CATCH(...)
+    {
+      set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+    }
+  }
+
+  numa_thread_pool* _pool_;
+  std::size_t _node_;
+  Rcvr _rcvr_;
+};
+} // namespace _numa
+
+USTDEX_API inline void numa_thread_pool::_push(std::size_t _node, _task* _tsk)
+{
+  const std::size_t _count = _topo_.nodes.size();
+  if (_node == numa_any_node)
+  {
+    auto& _self = _numa::_this_worker();
+    _node       = _self._pool_ == this ? _self._node_ : _next_node_.fetch_add(1, std::memory_order_relaxed) % _count;
+  }
+
+  auto& _queue = _queues_[_node];
+  {
+    std::unique_lock _lock{_queue._mutex_};
+    _tsk->_next_         = &_queue._head_;
+    _queue._head_._tail_ = _queue._head_._tail_->_next_ = _tsk;
+    _queue._size_.fetch_add(1);
+  }
+
+  // Pairs with the sleeping worker publishing itself as idle before it checks
+  // the queue sizes one last time: either the worker sees the new task, or we
+  // see the worker.
+  if (_idle_.load() == 0)
+  {
+    return;
+  }
+
+  if (_queue._idle_.load() != 0)
+  {
+    _queue._cv_.notify_one();
+    return;
+  }
+
+  // Every worker of the node is busy. Wake an idle worker of the nearest other
+  // node so it can take the work. The worker holds its queue's lock from the
+  // moment it is counted as idle until it waits, so taking the lock before the
+  // notification ensures that the notification is not lost.
+  for (std::size_t _i = 1; _i < _count; ++_i)
+  {
+    auto& _other = _queues_[(_node + _i) % _count];
+    if (_other._idle_.load() != 0)
+    {
+      {
+        std::unique_lock _lock{_other._mutex_};
+      }
+      _other._cv_.notify_one();
+      return;
+    }
+  }
+}
+
+USTDEX_API inline auto numa_thread_pool::_try_pop(std::size_t _node) -> _task*
+{
+  auto& _queue = _queues_[_node];
+  if (_queue._size_.load(std::memory_order_relaxed) == 0)
+  {
+    return nullptr;
+  }
+  std::unique_lock _lock{_queue._mutex_};
+  if (_queue._head_._next_ == &_queue._head_)
+  {
+    return nullptr;
+  }
+  if (_queue._head_._tail_ == _queue._head_._next_)
+  {
+    _queue._head_._tail_ = &_queue._head_;
+  }
+  _queue._size_.fetch_sub(1, std::memory_order_relaxed);
+  return ustdex::_exchange(_queue._head_._next_, _queue._head_._next_->_next_);
+}
+
+USTDEX_API inline auto numa_thread_pool::_pop_or_wait(std::size_t _node) -> _task*
+{
+  const std::size_t _count = _topo_.nodes.size();
+  auto& _queue             = _queues_[_node];
+  for (;;)
+  {
+    // Local work first, then work from the other nodes.
+    for (std::size_t _i = 0; _i < _count; ++_i)
+    {
+      if (_task* _tsk = _try_pop((_node + _i) % _count))
+      {
+        return _tsk;
+      }
+    }
+
+    std::unique_lock _lock{_queue._mutex_};
+    if (_queue._head_._next_ != &_queue._head_)
+    {
+      continue;
+    }
+    if (_stop_.load())
+    {
+      return nullptr;
+    }
+    _queue._idle_.fetch_add(1);
+    _idle_.fetch_add(1);
+    if (!_has_work())
+    {
+      _queue._cv_.wait(_lock);
+    }
+    _idle_.fetch_sub(1);
+    _queue._idle_.fetch_sub(1);
+  }
+}
+
+USTDEX_API inline auto numa_thread_pool::_has_work() const noexcept -> bool
+{
+  for (std::size_t _node = 0; _node < _topo_.nodes.size(); ++_node)
+  {
+    if (_queues_[_node]._size_.load() != 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+USTDEX_API inline void numa_thread_pool::_worker(std::size_t _node) noexcept
+{
+  _numa::_this_worker() = _numa::_worker_info{this, _node};
+  _numa::_set_this_thread_affinity(_topo_.nodes[_node].cpus);
+  while (_task* _tsk = _pop_or_wait(_node))
+  {
+    _tsk->_execute();
+  }
+  _numa::_this_worker() = _numa::_worker_info{};
+}
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
@@ -0,0 +1,243 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_OPSTATE_LAYOUT
+#define USTDEX_DETAIL_OPSTATE_LAYOUT
+
+#include "config.hpp"
+
+// Type names and strings are only needed on the host.
+#if !defined(__CUDA_ARCH__)
+
+#  include "concepts.hpp"
+#  include "cpos.hpp"
+#  include "env.hpp"
+#  include "meta.hpp"
+#  include "type_traits.hpp"
+
+#  include <cstddef>
+#  include <cstdlib>
+#  include <string>
+#  include <typeinfo>
+#  include <vector>
+
+#  if __has_include(<cxxabi.h>)
+#    include <cxxabi.h>
+#  endif
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+//! \brief The size and alignment of the operation state of a sender, and of
+//! the operation states of its child senders.
+//!
+//! Sizes are measured by connecting each sender to a stateless receiver whose
+//! environment is the one passed to `get_opstate_layout`. Receivers that the
+//! adaptors pass to their children usually hold a pointer back to the parent,
+//! so the real child operation states can be slightly larger. Children are the
+//! template arguments of a sender type that are themselves senders; operation
+//! states created at runtime, such as the one for the sender returned by the
+//! `let_value` function, are part of the parent's own size.
+struct opstate_layout
+{
+  std::string name;
+  std::size_t size  = 0;
+  std::size_t align = 0;
+  bool connectable  = true;
+  std::vector<opstate_layout> children;
+
+  //! The part of the operation state not accounted for by the children.
+  USTDEX_API auto own_size() const noexcept -> std::size_t
+  {
+    std::size_t _sum = 0;
+    for (auto& _child : children)
+    {
+      _sum += _child.size;
+    }
+    return _sum < size ? size - _sum : 0;
+  }
+
+  //! Formats the layout as an indented tree, one sender per line.
+  USTDEX_API auto to_string() const -> std::string
+  {
+    std::string _out;
+    _append(_out, 0);
+    return _out;
+  }
+
+private:
+  USTDEX_API void _append(std::string& _out, std::size_t _depth) const
+  {
+    _out.append(2 * _depth, ' ');
+    _out += name;
+    if (connectable)
+    {
+      _out += "  size=" + std::to_string(size) + " align=" + std::to_string(align);
+      if (!children.empty())
+      {
+        _out += " own=" + std::to_string(own_size());
+      }
+    }
+    else
+    {
+      _out += "  (not connectable in this environment)";
+    }
+    _out += '\n';
+    for (auto& _child : children)
+    {
+      _child._append(_out, _depth + 1);
+    }
+  }
+};
+
+namespace _opl
+{
+template <class Env>
+struct _probe_rcvr_t
+{
+  using receiver_concept = receiver_t;
+
+  template <class... As>
+  USTDEX_API void set_value(As&&...) noexcept
+  {}
+
+  template <class Error>
+  USTDEX_API void set_error(Error&&) noexcept
+  {}
+
+  USTDEX_API void set_stopped() noexcept {}
+
+  // Only used in unevaluated contexts.
+  USTDEX_API auto get_env() const noexcept -> Env;
+};
+
+USTDEX_API inline auto _demangle(const char* _name) -> std::string
+{
+#  if __has_include(<cxxabi.h>)
+  int _status = 0;
+  char* _buf  = abi::__cxa_demangle(_name, nullptr, nullptr, &_status);
+  if (_status == 0 && _buf != nullptr)
+  {
+    std::string _result{_buf};
+    std::free(_buf);
+    return _result;
+  }
+#  endif
+  return _name;
+}
+
+// Replaces the template arguments of a type name with "<...>" and drops the
+// namespace qualification, which leaves names that fit on a line.
+USTDEX_API inline auto _abbreviate(const std::string& _name) -> std::string
+{
+  std::string _out;
+  int _depth = 0;
+  for (char _ch : _name)
+  {
+    if (_ch == '<' && _depth++ == 0)
+    {
+      _out += "<...>";
+    }
+    else if (_ch == '>')
+    {
+      --_depth;
+    }
+    else if (_depth == 0)
+    {
+      _out += _ch;
+    }
+  }
+  constexpr char _prefix[] = "ustdex::";
+  for (auto _pos = _out.find(_prefix); _pos != std::string::npos; _pos = _out.find(_prefix))
+  {
+    _out.erase(_pos, sizeof(_prefix) - 1);
+  }
+  return _out;
+}
+
+template <class Sndr>
+using _tag_of_t = decltype(declval<Sndr&>()._tag_);
+
+// Adaptors are named after their tag type, other senders after their own type.
+template <class Sndr>
+USTDEX_API auto _sender_name() -> std::string
+{
+  using _named_t = _m_call<_m_try_q<_tag_of_t, Sndr>, Sndr>;
+  return _opl::_abbreviate(_opl::_demangle(typeid(_named_t).name()));
+}
+
+template <class Sndr>
+struct _children
+{
+  using type = _m_list<>;
+};
+
+template <template <class...> class Sndr, class... Args>
+struct _children<Sndr<Args...>>
+{
+  using type = _m_call<_m_concat, _m_if<sender<Args>, _m_list<Args>, _m_list<>>...>;
+};
+
+template <class Env>
+struct _layout_fn
+{
+  template <class Sndr>
+  USTDEX_API auto operator()() const -> opstate_layout
+  {
+    opstate_layout _layout;
+    _layout.name = _opl::_sender_name<Sndr>();
+    if constexpr (sender_in<Sndr, Env>)
+    {
+      using _opstate_t = connect_result_t<Sndr, _probe_rcvr_t<Env>>;
+      _layout.size     = sizeof(_opstate_t);
+      _layout.align    = alignof(_opstate_t);
+    }
+    else
+    {
+      _layout.connectable = false;
+    }
+    _append_children(_layout, static_cast<typename _children<Sndr>::type*>(nullptr));
+    return _layout;
+  }
+
+  template <class... Children>
+  USTDEX_API void _append_children(opstate_layout& _layout, _m_list<Children...>*) const
+  {
+    (_layout.children.push_back(_layout_fn{}.template operator()<Children>()), ...);
+  }
+};
+} // namespace _opl
+
+//! \brief Returns the layout of the operation state that results from
+//! connecting a sender with the given type in an environment with the given
+//! type. The sender is not connected.
+inline constexpr struct get_opstate_layout_t
+{
+  template <class Sndr, class Env = env<>>
+  USTDEX_API auto operator()(const Sndr&, const Env& = {}) const -> opstate_layout
+  {
+    return _opl::_layout_fn<Env>{}.template operator()<Sndr>();
+  }
+} get_opstate_layout{};
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
@@ -0,0 +1,284 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_PARALLEL
+#define USTDEX_DETAIL_PARALLEL
+
+#include "config.hpp"
+
+#if !defined(__CUDA_ARCH__)
+
+#  include "completion_signatures.hpp"
+#  include "cpos.hpp"
+#  include "exception.hpp"
+#  include "lazy.hpp"
+#  include "queries.hpp"
+#  include "type_traits.hpp"
+
+#  include <algorithm>
+#  include <atomic>
+#  include <iterator>
+#  include <memory>
+#  include <system_error>
+#  include <type_traits>
+#  include <utility>
+#  include <vector>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+//! \brief The domain of schedulers that do not customize the parallel
+//! algorithms. Algorithms like `reduce` run serially on such a scheduler, in a
+//! single piece of work.
+//!
+//! A scheduler opts into parallel execution by returning from its
+//! `get_domain` query a domain with a `parallelism(sch)` member that returns
+//! how many pieces of work it can run at once.
+struct default_domain
+{
+  template <class Sch>
+  USTDEX_API constexpr auto parallelism(const Sch&) const noexcept -> std::size_t
+  {
+    return 1;
+  }
+};
+
+namespace _par
+{
+struct _parallelism_t
+{
+  template <class Domain, class Sch>
+  USTDEX_API auto operator()(const Domain& _dom, const Sch& _sch) const noexcept -> decltype(_dom.parallelism(_sch))
+  {
+    return _dom.parallelism(_sch);
+  }
+};
+
+template <class Rng>
+using _iterator_t = decltype(std::begin(std::declval<Rng&>()));
+
+template <class It>
+inline constexpr bool _random_access_iterator =
+  std::is_base_of_v<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>;
+
+template <class Rng>
+inline constexpr bool _random_access_range = _random_access_iterator<_iterator_t<Rng>>;
+
+// Returns how many chunks the parallel algorithms split their input into when
+// they run on `_sch`.
+template <class Sch>
+USTDEX_API auto _parallelism(const Sch& _sch) noexcept -> std::size_t
+{
+  if constexpr (_callable<get_domain_t, const Sch&>)
+  {
+    if constexpr (_callable<_parallelism_t, domain_of_t<const Sch&>, const Sch&>)
+    {
+      return (std::max)(std::size_t(1), _parallelism_t()(get_domain(_sch), _sch));
+    }
+  }
+  return default_domain().parallelism(_sch);
+}
+
+// Returns the bounds of chunk `_i` when `_size` elements are split into
+// `_count` chunks whose sizes differ by at most one.
+USTDEX_API inline auto _chunk(std::size_t _size, std::size_t _count, std::size_t _i) noexcept
+  -> std::pair<std::size_t, std::size_t>
+{
+  const std::size_t _base  = _size / _count;
+  const std::size_t _extra = _size % _count;
+  const std::size_t _begin = _i * _base + (std::min)(_i, _extra);
+  return {_begin, _begin + _base + (_i < _extra ? 1 : 0)};
+}
+
+// The completions of a parallel algorithm whose value completion is
+// `ValueSig`. Errors from the scheduler are reported as exception_ptrs, as are
+// exceptions thrown by the user's operations.
+template <class Sch, class ValueSig, class... Env>
+USTDEX_API constexpr auto _completions()
+{
+  USTDEX_LET(auto _sch_completions = ustdex::get_completion_signatures<schedule_result_t<Sch>, FWD_ENV_T<Env>...>())
+  {
+    return completion_signatures<ValueSig>() + _eptr_completion()
+         + transform_completion_signatures(_sch_completions, _swallow_transform(), _swallow_transform());
+  }
+}
+
+// Runs `_owner_->_run(i)` for every `i` in `[0, count)`, each in its own piece
+// of work scheduled on `Sch`, and then calls `_owner_->_join()` on the thread
+// that finished last. The owner can start another phase from `_join`. If
+// scheduling fails, or if `_run` throws, the remaining chunks are skipped and
+// `_disposition()` reports the failure.
+template <class Sch, class Env, class Owner>
+struct _fork_t
+{
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    USTDEX_API void set_value() noexcept
+    {
+      if (_fork_->_disposition() == _value)
+      {
+        USTDEX_TRY
+        {
+          _fork_->_owner_->_run(_index_);
+        }
+        USTDEX_CATCH(...)
+        {
+          _fork_->_fail(_error, ::std::current_exception());
+        }
+      }
+      _fork_->_arrive();
+    }
+
+    template <class Error>
+    USTDEX_API void set_error(Error _err) noexcept
+    {
+      if constexpr (USTDEX_IS_SAME(Error, ::std::exception_ptr))
+      {
+        _fork_->_fail(_error, static_cast<Error&&>(_err));
+      }
+      else if constexpr (USTDEX_IS_SAME(Error, ::std::error_code))
+      {
+        _fork_->_fail(_error, ::std::make_exception_ptr(::std::system_error(_err)));
+      }
+      else
+      {
+        _fork_->_fail(_error, ::std::make_exception_ptr(static_cast<Error&&>(_err)));
+      }
+      _fork_->_arrive();
+    }
+
+    USTDEX_API void set_stopped() noexcept
+    {
+      _fork_->_fail(_stopped, {});
+      _fork_->_arrive();
+    }
+
+    USTDEX_API auto get_env() const noexcept -> Env
+    {
+      return _fork_->_owner_->_env();
+    }
+
+    _fork_t* _fork_;
+    std::size_t _index_;
+  };
+
+  using _opstate_t = connect_result_t<schedule_result_t<Sch&>, _rcvr_t>;
+
+  // The operations of one phase. They stay alive until the whole algorithm is
+  // done, because the last of them is still running when the next phase starts.
+  struct _phase_t
+  {
+    USTDEX_API explicit _phase_t(std::size_t _count)
+        : _ops_{new _lazy<_opstate_t>[_count]}
+    {}
+
+    USTDEX_API _phase_t(_phase_t&&) noexcept = default;
+
+    USTDEX_API ~_phase_t()
+    {
+      for (std::size_t _i = 0; _ops_ && _i < _size_; ++_i)
+      {
+        _ops_[_i].destroy();
+      }
+    }
+
+    std::unique_ptr<_lazy<_opstate_t>[]> _ops_;
+    std::size_t _size_ = 0;
+  };
+
+  USTDEX_API explicit _fork_t(Sch _sch, Owner* _owner) noexcept
+      : _sch_{static_cast<Sch&&>(_sch)}
+      , _owner_{_owner}
+  {}
+
+  USTDEX_IMMOVABLE(_fork_t);
+
+  USTDEX_API void _start(std::size_t _count) noexcept
+  {
+    _phase_t* _phase = nullptr;
+    USTDEX_TRY
+    {
+      _phase = &_phases_.emplace_back(_count);
+      for (; _phase->_size_ < _count; ++_phase->_size_)
+      {
+        _phase->_ops_[_phase->_size_].construct_from(
+          ustdex::connect, ustdex::schedule(_sch_), _rcvr_t{this, _phase->_size_});
+      }
+    }
+    USTDEX_CATCH(...)
+    {
+      _fail(_error, ::std::current_exception());
+      _owner_->_join();
+      return;
+    }
+
+    auto* _ops = _phase->_ops_.get();
+    _remaining_.store(_count, std::memory_order_relaxed);
+    // The last chunk can complete the whole algorithm, so nothing here may
+    // touch `this` once it is started.
+    for (std::size_t _i = 0; _i < _count; ++_i)
+    {
+      ustdex::start(_ops[_i]._value_);
+    }
+  }
+
+  USTDEX_API auto _disposition() const noexcept -> _disposition_t
+  {
+    return _disposition_.load(std::memory_order_acquire);
+  }
+
+  USTDEX_API auto _exception() noexcept -> ::std::exception_ptr&
+  {
+    return _eptr_;
+  }
+
+  // Records the first failure.
+  USTDEX_API void _fail(_disposition_t _how, ::std::exception_ptr _eptr) noexcept
+  {
+    _disposition_t _expected = _value;
+    if (_disposition_.compare_exchange_strong(_expected, _how, std::memory_order_acq_rel))
+    {
+      _eptr_ = static_cast<::std::exception_ptr&&>(_eptr);
+    }
+  }
+
+  USTDEX_API void _arrive() noexcept
+  {
+    if (_remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      _owner_->_join();
+    }
+  }
+
+  Sch _sch_;
+  Owner* _owner_;
+  std::vector<_phase_t> _phases_{};
+  std::atomic<std::size_t> _remaining_{0};
+  std::atomic<_disposition_t> _disposition_{_value};
+  ::std::exception_ptr _eptr_{};
+};
+} // namespace _par
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
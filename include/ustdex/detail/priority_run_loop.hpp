@@ -0,0 +1,321 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_PRIORITY_RUN_LOOP
+#define USTDEX_DETAIL_PRIORITY_RUN_LOOP
+
+#include "config.hpp"
+
+// libcu++ does not have <cuda/std/mutex> or <cuda/std/condition_variable>
+#if !defined(__CUDA_ARCH__)
+
+#  include "completion_signatures.hpp"
+#  include "env.hpp"
+#  include "exception.hpp"
+#  include "queries.hpp"
+#  include "run_loop.hpp"
+#  include "utility.hpp"
+
+#  include <condition_variable>
+#  include <cstddef>
+#  include <mutex>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+template <std::size_t Levels>
+class priority_run_loop;
+
+template <std::size_t Levels, class Rcvr>
+struct _priority_operation : _task
+{
+  using operation_state_concept = operation_state_t;
+
+  USTDEX_API static void _execute_impl(_task* _p) noexcept
+  {
+    auto& _rcvr = static_cast<_priority_operation*>(_p)->_rcvr_;
+    USTDEX_TRY
+    {
+      if (get_stop_token(get_env(_rcvr)).stop_requested())
+      {
+        set_stopped(static_cast<Rcvr&&>(_rcvr));
+      }
+      else
+      {
+        set_value(static_cast<Rcvr&&>(_rcvr));
+      }
+    }
+    USTDEX_CATCH_ALL
+    {
+      set_error(static_cast<Rcvr&&>(_rcvr), ::std::current_exception());
+    }
+  }
+
+  USTDEX_API _priority_operation(priority_run_loop<Levels>* _loop, std::size_t _level, Rcvr _rcvr)
+      : _task{this, &_execute_impl}
+      , _loop_{_loop}
+      , _level_{_level}
+      , _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+  {}
+
+  USTDEX_IMMOVABLE(_priority_operation);
+
+  USTDEX_API void start() & noexcept
+  {
+    USTDEX_TRY
+    {
+      _loop_->_push_back(_level_, this);
+    }
+    USTDEX_CATCH(...)
+    {
+      set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+    }
+  }
+
+  priority_run_loop<Levels>* _loop_;
+  std::size_t _level_;
+  USTDEX_NO_UNIQUE_ADDRESS Rcvr _rcvr_;
+};
+
+//! \brief A run loop with `Levels` priority levels, each with its own FIFO
+//! queue. Level `Levels - 1` has the highest priority.
+//!
+//! Any number of threads may call `run()`. Each time a thread takes a task, it
+//! takes it from the highest non-empty level, unless a lower non-empty level
+//! has been passed over `aging_limit` times in a row, in which case that level
+//! is served once. This bounds how long low-priority work can be starved by a
+//! steady stream of high-priority work.
+template <std::size_t Levels>
+class USTDEX_TYPE_VISIBILITY_DEFAULT priority_run_loop
+{
+  static_assert(Levels > 0, "priority_run_loop needs at least one priority level");
+
+  template <std::size_t, class>
+  friend struct _priority_operation;
+
+public:
+  static constexpr std::size_t levels = Levels;
+
+  explicit priority_run_loop(std::size_t _aging_limit = 64) noexcept
+      : _aging_limit_{_aging_limit}
+  {
+    for (auto& _head : _heads_)
+    {
+      _head._next_ = _head._tail_ = &_head;
+    }
+  }
+
+  class _scheduler
+  {
+    struct _schedule_task
+    {
+      using sender_concept = sender_t;
+
+      template <class Rcvr>
+      USTDEX_API auto connect(Rcvr _rcvr) const noexcept -> _priority_operation<Levels, Rcvr>
+      {
+        return {_loop_, _level_, static_cast<Rcvr&&>(_rcvr)};
+      }
+
+      template <class Self>
+      USTDEX_API static constexpr auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_error_t(::std::exception_ptr), set_stopped_t()>();
+      }
+
+      struct _env
+      {
+        priority_run_loop* _loop_;
+        std::size_t _level_;
+
+        template <class Tag>
+        USTDEX_API auto query(get_completion_scheduler_t<Tag>) const noexcept -> _scheduler
+        {
+          return _scheduler{_loop_, _level_};
+        }
+      };
+
+      USTDEX_API auto get_env() const noexcept -> _env
+      {
+        return _env{_loop_, _level_};
+      }
+
+    private:
+      friend _scheduler;
+
+      USTDEX_API explicit _schedule_task(priority_run_loop* _loop, std::size_t _level) noexcept
+          : _loop_(_loop)
+          , _level_(_level)
+      {}
+
+      priority_run_loop* _loop_;
+      std::size_t _level_;
+    };
+
+    friend priority_run_loop;
+
+    USTDEX_API explicit _scheduler(priority_run_loop* _loop, std::size_t _level) noexcept
+        : _loop_(_loop)
+        , _level_(_level)
+    {}
+
+    priority_run_loop* _loop_;
+    std::size_t _level_;
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    [[nodiscard]] USTDEX_API auto schedule() const noexcept -> _schedule_task
+    {
+      return _schedule_task{_loop_, _level_};
+    }
+
+    [[nodiscard]] USTDEX_API auto priority() const noexcept -> std::size_t
+    {
+      return _level_;
+    }
+
+    USTDEX_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    USTDEX_API friend bool operator==(const _scheduler& _a, const _scheduler& _b) noexcept
+    {
+      return _a._loop_ == _b._loop_ && _a._level_ == _b._level_;
+    }
+
+    USTDEX_API friend bool operator!=(const _scheduler& _a, const _scheduler& _b) noexcept
+    {
+      return !(_a == _b);
+    }
+  };
+
+  //! Returns a scheduler that enqueues work at the given priority level.
+  USTDEX_API auto get_scheduler(std::size_t _priority) noexcept -> _scheduler
+  {
+    USTDEX_ASSERT(_priority < Levels, "priority level out of range");
+    return _scheduler{this, _priority};
+  }
+
+  USTDEX_API void run();
+
+  USTDEX_API void finish();
+
+private:
+  USTDEX_API void _push_back(std::size_t _level, _task* _tsk);
+  USTDEX_API auto _pop_front() -> _task*;
+  USTDEX_API auto _select_level() noexcept -> std::size_t;
+
+  std::mutex _mutex_{};
+  std::condition_variable _cv_{};
+  _task _heads_[Levels]{};
+  std::size_t _skipped_[Levels]{};
+  std::size_t _size_        = 0;
+  std::size_t _aging_limit_ = 0;
+  bool _stop_               = false;
+};
+
+template <std::size_t Levels>
+USTDEX_API inline void priority_run_loop<Levels>::run()
+{
+  while (_task* _tsk = _pop_front())
+  {
+    _tsk->_execute();
+  }
+}
+
+template <std::size_t Levels>
+USTDEX_API inline void priority_run_loop<Levels>::finish()
+{
+  ::std::unique_lock _lock{_mutex_};
+  _stop_ = true;
+  _cv_.notify_all();
+}
+
+template <std::size_t Levels>
+USTDEX_API inline void priority_run_loop<Levels>::_push_back(std::size_t _level, _task* _tsk)
+{
+  ::std::unique_lock _lock{_mutex_};
+  _task& _head = _heads_[_level];
+  _tsk->_next_ = &_head;
+  _head._tail_ = _head._tail_->_next_ = _tsk;
+  ++_size_;
+  _cv_.notify_one();
+}
+
+// Must be called with the mutex held and at least one task queued.
+template <std::size_t Levels>
+USTDEX_API inline auto priority_run_loop<Levels>::_select_level() noexcept -> std::size_t
+{
+  std::size_t _top = Levels - 1;
+  while (_heads_[_top]._next_ == &_heads_[_top])
+  {
+    --_top;
+  }
+
+  // Serve the most starved lower level if it has waited long enough.
+  std::size_t _aged = _top;
+  for (std::size_t _level = 0; _level < _top; ++_level)
+  {
+    if (_heads_[_level]._next_ != &_heads_[_level] && _skipped_[_level] >= _aging_limit_
+        && (_aged == _top || _skipped_[_level] > _skipped_[_aged]))
+    {
+      _aged = _level;
+    }
+  }
+
+  // Every other non-empty level below the top one is passed over.
+  for (std::size_t _level = 0; _level < _top; ++_level)
+  {
+    if (_heads_[_level]._next_ != &_heads_[_level])
+    {
+      ++_skipped_[_level];
+    }
+  }
+  _skipped_[_aged] = 0;
+  return _aged;
+}
+
+template <std::size_t Levels>
+USTDEX_API inline auto priority_run_loop<Levels>::_pop_front() -> _task*
+{
+  ::std::unique_lock _lock{_mutex_};
+  _cv_.wait(_lock, [this] {
+    return _size_ != 0 || _stop_;
+  });
+  if (_size_ == 0)
+  {
+    return nullptr;
+  }
+
+  --_size_;
+  _task& _head = _heads_[_select_level()];
+  if (_head._tail_ == _head._next_)
+  {
+    _head._tail_ = &_head;
+  }
+  return ustdex::_exchange(_head._next_, _head._next_->_next_);
+}
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
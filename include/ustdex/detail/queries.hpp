@@ -61,6 +61,26 @@ inline constexpr struct get_allocator_t
   }
 } get_allocator{};
 
+//! \brief Queries whether the `let_*` algorithms should allocate the operation
+//! state of the sender returned by their function with the environment's
+//! allocator, when the function is called, instead of reserving inline room
+//! for the largest one. Returns a `std::bool_constant`; the default is
+//! `std::false_type`.
+inline constexpr struct allocate_let_opstate_t
+{
+  template <class Env>
+  USTDEX_API constexpr auto operator()(const Env& _env) const noexcept -> decltype(_env.query(*this))
+  {
+    static_assert(noexcept(_env.query(*this)));
+    return _env.query(*this);
+  }
+
+  USTDEX_API constexpr auto operator()(_ignore) const noexcept -> std::false_type
+  {
+    return {};
+  }
+} allocate_let_opstate{};
+
 inline constexpr struct get_stop_token_t
 {
   template <class Env>
@@ -76,6 +96,23 @@ inline constexpr struct get_stop_token_t
   }
 } get_stop_token{};
 
+//! \brief Queries an environment for a tracer. Adaptors that support tracing
+//! call the tracer as
+//! `tracer(Tag(), trace_event, const void* id, std::chrono::steady_clock::time_point)`
+//! when their operation starts and when it completes, where `Tag` is the
+//! adaptor's tag type and `id` identifies the operation across its events.
+//! The tracer is looked up on each event and must not throw. There is no
+//! default; without a tracer, tracing compiles out.
+inline constexpr struct get_tracer_t
+{
+  template <class Env>
+  USTDEX_API auto operator()(const Env& _env) const noexcept -> decltype(_env.query(*this))
+  {
+    static_assert(noexcept(_env.query(*this)));
+    return _env.query(*this);
+  }
+} get_tracer{};
+
 template <class Ty>
 using stop_token_of_t = USTDEX_DECAY(_call_result_t<get_stop_token_t, Ty>);
 
@@ -158,6 +195,19 @@ inline constexpr struct get_domain_t
 template <class Sch>
 using domain_of_t = _call_result_t<get_domain_t, Sch>;
 
+//! \brief Queries the NUMA node on which a scheduler runs its work, or on
+//! which the data of an operation lives. Returns the operating system's node
+//! number.
+inline constexpr struct get_numa_node_t
+{
+  template <class Env>
+  USTDEX_API auto operator()(const Env& _env) const noexcept -> decltype(_env.query(*this))
+  {
+    static_assert(noexcept(_env.query(*this)));
+    return _env.query(*this);
+  }
+} get_numa_node{};
+
 } // namespace ustdex
 
 #include "epilogue.hpp"
@@ -87,8 +87,8 @@ template <class Query>
 struct USTDEX_TYPE_VISIBILITY_DEFAULT read_env_t::_sndr_t
 {
   using sender_concept = sender_t;
-  USTDEX_NO_UNIQUE_ADDRESS read_env_t _tag;
-  USTDEX_NO_UNIQUE_ADDRESS Query _query;
+  USTDEX_NO_UNIQUE_ADDRESS read_env_t _tag_;
+  USTDEX_NO_UNIQUE_ADDRESS Query _query_;
 
   template <class Self, class Env>
   USTDEX_API static constexpr auto get_completion_signatures()
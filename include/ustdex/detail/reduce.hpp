@@ -0,0 +1,294 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_REDUCE
+#define USTDEX_DETAIL_REDUCE
+
+#include "config.hpp"
+
+#if !defined(__CUDA_ARCH__)
+
+#  include "cpos.hpp"
+#  include "exception.hpp"
+#  include "parallel.hpp"
+#  include "trace.hpp"
+
+#  include <atomic>
+#  include <functional>
+#  include <iterator>
+#  include <memory>
+#  include <optional>
+#  include <type_traits>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+namespace _par
+{
+struct _identity_fn
+{
+  template <class Ty>
+  USTDEX_TRIVIAL_API constexpr auto operator()(Ty&& _ty) const noexcept -> Ty&&
+  {
+    return static_cast<Ty&&>(_ty);
+  }
+};
+
+// Splits the range into one chunk per unit of the scheduler's parallelism.
+// Each chunk reduces its elements on a worker, and the partial results are
+// combined pairwise up a binary tree: of the two chunks that meet at a node,
+// the one that gets there last combines them and carries on upwards, so no
+// chunk ever waits for another.
+template <class Tag>
+struct _reduce
+{
+protected:
+  template <class Rcvr, class Sch, class Rng, class Ty, class ReduceOp, class TransformOp>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using _env_t                  = FWD_ENV_T<env_of_t<Rcvr>>;
+    using _fork_t                 = _par::_fork_t<Sch, _env_t, _opstate_t>;
+
+    USTDEX_API _opstate_t(Rcvr _rcvr, Sch _sch, Rng _rng, Ty _init, ReduceOp _reduce, TransformOp _transform)
+        : _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+        , _rng_{static_cast<Rng&&>(_rng)}
+        , _init_{static_cast<Ty&&>(_init)}
+        , _reduce_{static_cast<ReduceOp&&>(_reduce)}
+        , _transform_{static_cast<TransformOp&&>(_transform)}
+        , _fork_{static_cast<Sch&&>(_sch), this}
+    {}
+
+    USTDEX_IMMOVABLE(_opstate_t);
+
+    USTDEX_API void start() & noexcept
+    {
+      ustdex::_trace_start(_rcvr_);
+      _size_  = static_cast<std::size_t>(std::distance(std::begin(_rng_), std::end(_rng_)));
+      _count_ = (std::min)(_par::_parallelism(_fork_._sch_), (std::max)(_size_, std::size_t(1)));
+      USTDEX_TRY
+      {
+        _partials_.reset(new std::optional<Ty>[_count_]);
+        _arrived_.reset(new std::atomic<bool>[_count_]());
+      }
+      USTDEX_CATCH(...)
+      {
+        ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+        return;
+      }
+      _fork_._start(_count_);
+    }
+
+    USTDEX_API void _run(std::size_t _index)
+    {
+      auto [_begin, _end] = _par::_chunk(_size_, _count_, _index);
+      if (_begin == _end)
+      {
+        return; // the range is empty
+      }
+
+      auto _first = std::begin(_rng_) + _begin;
+      auto _last  = std::begin(_rng_) + _end;
+      Ty _partial(_transform_(*_first));
+      while (++_first != _last)
+      {
+        _partial = _reduce_(static_cast<Ty&&>(_partial), _transform_(*_first));
+      }
+      _partials_[_index].emplace(static_cast<Ty&&>(_partial));
+
+      for (std::size_t _stride = 1; _stride < _count_; _stride *= 2)
+      {
+        // The right child of each node is the only chunk that ends there, so it
+        // identifies the node.
+        std::size_t _left = _index;
+        if (_index % (2 * _stride) != 0)
+        {
+          _left = _index - _stride;
+        }
+        else if (_index + _stride >= _count_)
+        {
+          continue; // no right sibling at this level
+        }
+
+        if (!_arrived_[_left + _stride].exchange(true, std::memory_order_acq_rel))
+        {
+          return; // the sibling is still running, and will carry on
+        }
+
+        _index             = _left;
+        _partials_[_index] = _reduce_(static_cast<Ty&&>(*_partials_[_index]), //
+                                      static_cast<Ty&&>(*_partials_[_index + _stride]));
+      }
+    }
+
+    USTDEX_API void _join() noexcept
+    {
+      switch (_fork_._disposition())
+      {
+        case _value:
+          USTDEX_TRY
+          {
+            if (_size_ == 0)
+            {
+              ustdex::set_value(static_cast<Rcvr&&>(_rcvr_), static_cast<Ty&&>(_init_));
+            }
+            else
+            {
+              Ty _result(_reduce_(static_cast<Ty&&>(_init_), static_cast<Ty&&>(*_partials_[0])));
+              ustdex::set_value(static_cast<Rcvr&&>(_rcvr_), static_cast<Ty&&>(_result));
+            }
+          }
+          USTDEX_CATCH(...)
+          {
+            ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+          }
+          break;
+        case _error:
+          ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), static_cast<::std::exception_ptr&&>(_fork_._exception()));
+          break;
+        case _stopped:
+          ustdex::set_stopped(static_cast<Rcvr&&>(_rcvr_));
+          break;
+      }
+    }
+
+    USTDEX_API auto _env() const noexcept -> _env_t
+    {
+      return ustdex::get_env(_rcvr_);
+    }
+
+    Rcvr _rcvr_;
+    Rng _rng_;
+    Ty _init_;
+    ReduceOp _reduce_;
+    TransformOp _transform_;
+    std::size_t _size_  = 0;
+    std::size_t _count_ = 0;
+    std::unique_ptr<std::optional<Ty>[]> _partials_{};
+    std::unique_ptr<std::atomic<bool>[]> _arrived_{};
+    _fork_t _fork_;
+  };
+
+  template <class Sch, class Rng, class Ty, class ReduceOp, class TransformOp>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _sndr_t
+  {
+    using sender_concept = sender_t;
+
+    template <class Self, class... Env>
+    USTDEX_API static constexpr auto get_completion_signatures()
+    {
+      return _par::_completions<Sch, set_value_t(Ty), Env...>();
+    }
+
+    template <class Rcvr>
+    using _opstate_for_t = _opstate_t<_traced_rcvr_t<Tag, Rcvr>, Sch, Rng, Ty, ReduceOp, TransformOp>;
+
+    template <class Rcvr>
+    USTDEX_API auto connect(Rcvr _rcvr) && -> _opstate_for_t<Rcvr>
+    {
+      return _opstate_for_t<Rcvr>{
+        ustdex::_trace_rcvr<Tag>(static_cast<Rcvr&&>(_rcvr)),
+        static_cast<Sch&&>(_sch_),
+        static_cast<Rng&&>(_rng_),
+        static_cast<Ty&&>(_init_),
+        static_cast<ReduceOp&&>(_reduce_),
+        static_cast<TransformOp&&>(_transform_)};
+    }
+
+    template <class Rcvr>
+    USTDEX_API auto connect(Rcvr _rcvr) const& -> _opstate_for_t<Rcvr>
+    {
+      return _opstate_for_t<Rcvr>{
+        ustdex::_trace_rcvr<Tag>(static_cast<Rcvr&&>(_rcvr)), _sch_, _rng_, _init_, _reduce_, _transform_};
+    }
+
+    USTDEX_NO_UNIQUE_ADDRESS Tag _tag_;
+    Sch _sch_;
+    Rng _rng_;
+    Ty _init_;
+    ReduceOp _reduce_;
+    TransformOp _transform_;
+  };
+
+  // An lvalue range is referred to, not copied, and must outlive the
+  // operation. An rvalue range is moved into the sender.
+  template <class Sch, class Rng, class Ty, class ReduceOp, class TransformOp>
+  USTDEX_API static auto _make(Sch _sch, Rng&& _rng, Ty _init, ReduceOp _reduce, TransformOp _transform)
+    -> _sndr_t<Sch, Rng, Ty, ReduceOp, TransformOp>
+  {
+    static_assert(_random_access_range<Rng>, "the parallel algorithms require a random-access range");
+    return _sndr_t<Sch, Rng, Ty, ReduceOp, TransformOp>{
+      {},
+      static_cast<Sch&&>(_sch),
+      static_cast<Rng&&>(_rng),
+      static_cast<Ty&&>(_init),
+      static_cast<ReduceOp&&>(_reduce),
+      static_cast<TransformOp&&>(_transform)};
+  }
+};
+} // namespace _par
+
+//! \brief Returns a sender that reduces the elements of a random-access range
+//! with `_reduce`, starting from `_init`, and completes with the result. The
+//! range is split into chunks that run in parallel on `_sch` when its domain
+//! supports it, so `_reduce` must be associative and commutative. On other
+//! schedulers, like `run_loop`, the whole range is reduced in one piece of
+//! work.
+struct reduce_t : _par::_reduce<reduce_t>
+{
+  template <class Sch, class Rng, class Ty, class ReduceOp = std::plus<>>
+  USTDEX_API auto operator()(Sch _sch, Rng&& _rng, Ty _init, ReduceOp _reduce = {}) const
+  {
+    return _make(static_cast<Sch&&>(_sch),
+                 static_cast<Rng&&>(_rng),
+                 static_cast<Ty&&>(_init),
+                 static_cast<ReduceOp&&>(_reduce),
+                 _par::_identity_fn());
+  }
+};
+
+//! \brief Like `reduce`, but reduces the results of calling `_transform` on
+//! each element, without storing them.
+struct transform_reduce_t : _par::_reduce<transform_reduce_t>
+{
+  template <class Sch, class Rng, class Ty, class ReduceOp, class TransformOp>
+  USTDEX_API auto operator()(Sch _sch, Rng&& _rng, Ty _init, ReduceOp _reduce, TransformOp _transform) const
+  {
+    return _make(static_cast<Sch&&>(_sch),
+                 static_cast<Rng&&>(_rng),
+                 static_cast<Ty&&>(_init),
+                 static_cast<ReduceOp&&>(_reduce),
+                 static_cast<TransformOp&&>(_transform));
+  }
+};
+
+inline constexpr reduce_t reduce{};
+inline constexpr transform_reduce_t transform_reduce{};
+
+template <>
+inline constexpr const char* trace_name_v<reduce_t> = "reduce";
+
+template <>
+inline constexpr const char* trace_name_v<transform_reduce_t> = "transform_reduce";
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
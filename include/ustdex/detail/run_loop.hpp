@@ -26,12 +26,20 @@
 #  include "completion_signatures.hpp"
 #  include "env.hpp"
 #  include "exception.hpp"
+#  include "lock_profile.hpp"
 #  include "queries.hpp"
+#  include "trace.hpp"
 #  include "utility.hpp"
 
 #  include <condition_variable>
 #  include <mutex>
 
+#  if USTDEX_RUN_LOOP_METRICS()
+#    include "run_loop_metrics.hpp"
+
+#    include <algorithm>
+#  endif
+
 #  include "prologue.hpp"
 
 namespace ustdex
@@ -62,6 +70,10 @@ struct _task : _immovable
     _execute_fn_t* _execute_fn_;
   };
 
+#  if USTDEX_RUN_LOOP_METRICS()
+  std::chrono::steady_clock::time_point _enqueued_{};
+#  endif
+
   USTDEX_API void _execute() noexcept
   {
     (*_execute_fn_)(this);
@@ -77,6 +89,22 @@ struct _operation : _task
   USTDEX_API static void _execute_impl(_task* _p) noexcept
   {
     auto& _rcvr = static_cast<_operation*>(_p)->_rcvr_;
+    if constexpr (_has_tracer<env_of_t<Rcvr>>)
+    {
+      // Completing may destroy this operation, so fetch the tracer first.
+      auto _tracer    = ustdex::get_tracer(ustdex::get_env(_rcvr));
+      const void* _id = &_rcvr;
+      _complete(_rcvr);
+      _tracer(schedule_t(), trace_event::returned, _id, std::chrono::steady_clock::now());
+    }
+    else
+    {
+      _complete(_rcvr);
+    }
+  }
+
+  USTDEX_API static void _complete(Rcvr& _rcvr) noexcept
+  {
     USTDEX_TRY
     {
       if (get_stop_token(get_env(_rcvr)).stop_requested())
@@ -130,9 +158,9 @@ public:
       using sender_concept = sender_t;
 
       template <class Rcvr>
-      USTDEX_API auto connect(Rcvr _rcvr) const noexcept -> _operation<Rcvr>
+      USTDEX_API auto connect(Rcvr _rcvr) const noexcept -> _operation<_traced_rcvr_t<schedule_t, Rcvr>>
       {
-        return {&_loop_->_head, _loop_, static_cast<Rcvr&&>(_rcvr)};
+        return {&_loop_->_head, _loop_, ustdex::_trace_rcvr<schedule_t>(static_cast<Rcvr&&>(_rcvr))};
       }
 
       template <class Self>
@@ -141,9 +169,6 @@ public:
         return completion_signatures<set_value_t(), set_error_t(::std::exception_ptr), set_stopped_t()>();
       }
 
-    private:
-      friend _scheduler;
-
       struct _env
       {
         run_loop* _loop_;
@@ -160,6 +185,9 @@ public:
         return _env{_loop_};
       }
 
+    private:
+      friend _scheduler;
+
       USTDEX_API explicit _schedule_task(run_loop* _loop) noexcept
           : _loop_(_loop)
       {}
@@ -208,7 +236,20 @@ public:
 
   USTDEX_API void finish();
 
+#  if USTDEX_RUN_LOOP_METRICS()
+  //! \brief Returns the loop's queue depth and task timings so far. Only
+  //! available when built with `USTDEX_ENABLE_RUN_LOOP_METRICS`.
+  USTDEX_API auto metrics() const noexcept -> run_loop_metrics
+  {
+    return {_depth_.load(std::memory_order_relaxed),
+            _max_depth_.load(std::memory_order_relaxed),
+            _queue_time_.snapshot(),
+            _execution_time_.snapshot()};
+  }
+#  endif
+
 private:
+  USTDEX_API auto _acquire() -> ::std::unique_lock<::std::mutex>;
   USTDEX_API void _push_back(_task* _tsk);
   USTDEX_API auto _pop_front() -> _task*;
 
@@ -216,11 +257,26 @@ private:
   ::std::condition_variable _cv{};
   _task _head{};
   bool _stop = false;
+
+#  if USTDEX_LOCK_PROFILING()
+  // Waits in _cv re-acquire the mutex without going through _acquire(), so
+  // they are not counted.
+  _lock_profile _lock_profile_{"run_loop", this};
+#  endif
+
+#  if USTDEX_RUN_LOOP_METRICS()
+  // Updated with the mutex held, and read without it by metrics().
+  std::atomic<std::size_t> _depth_{0};
+  std::atomic<std::size_t> _max_depth_{0};
+  latency_histogram _queue_time_;
+  latency_histogram _execution_time_;
+#  endif
 };
 
 template <class Rcvr>
 USTDEX_API inline void _operation<Rcvr>::start() & noexcept
 {
+  ustdex::_trace_start(_rcvr_);
   USTDEX_TRY
   {
     _loop_->_push_back(this);
@@ -235,28 +291,64 @@ USTDEX_API inline void run_loop::run()
 {
   for (_task* _tsk = _pop_front(); _tsk != &_head; _tsk = _pop_front())
   {
+#  if USTDEX_RUN_LOOP_METRICS()
+    // Read the timestamp first; executing the task may destroy it.
+    const auto _start = std::chrono::steady_clock::now();
+    _queue_time_.record(_start - _tsk->_enqueued_);
+    _tsk->_execute();
+    _execution_time_.record(std::chrono::steady_clock::now() - _start);
+#  else
     _tsk->_execute();
+#  endif
   }
 }
 
 USTDEX_API inline void run_loop::finish()
 {
-  ::std::unique_lock _lock{_mutex};
+  auto _lock = _acquire();
   _stop = true;
   _cv.notify_all();
 }
 
+USTDEX_API inline auto run_loop::_acquire() -> ::std::unique_lock<::std::mutex>
+{
+#  if USTDEX_LOCK_PROFILING()
+  ::std::unique_lock _lock{_mutex, ::std::try_to_lock};
+  if (_lock.owns_lock())
+  {
+    _lock_profile_._record(false, 0, {});
+  }
+  else
+  {
+    const auto _since = ::std::chrono::steady_clock::now();
+    _lock.lock();
+    _lock_profile_._record(true, 0, ::std::chrono::steady_clock::now() - _since);
+  }
+  return _lock;
+#  else
+  return ::std::unique_lock{_mutex};
+#  endif
+}
+
 USTDEX_API inline void run_loop::_push_back(_task* _tsk)
 {
-  ::std::unique_lock _lock{_mutex};
+#  if USTDEX_RUN_LOOP_METRICS()
+  _tsk->_enqueued_ = std::chrono::steady_clock::now();
+#  endif
+  auto _lock = _acquire();
   _tsk->_next_ = &_head;
   _head._tail_ = _head._tail_->_next_ = _tsk;
+#  if USTDEX_RUN_LOOP_METRICS()
+  const std::size_t _depth = _depth_.load(std::memory_order_relaxed) + 1;
+  _depth_.store(_depth, std::memory_order_relaxed);
+  _max_depth_.store((std::max)(_depth, _max_depth_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+#  endif
   _cv.notify_one();
 }
 
 USTDEX_API inline auto run_loop::_pop_front() -> _task*
 {
-  ::std::unique_lock _lock{_mutex};
+  auto _lock = _acquire();
   _cv.wait(_lock, [this] {
     return _head._next_ != &_head || _stop;
   });
@@ -264,6 +356,12 @@ USTDEX_API inline auto run_loop::_pop_front() -> _task*
   {
     _head._tail_ = &_head;
   }
+#  if USTDEX_RUN_LOOP_METRICS()
+  if (_head._next_ != &_head)
+  {
+    _depth_.store(_depth_.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+  }
+#  endif
   return ustdex::_exchange(_head._next_, _head._next_->_next_);
 }
 } // namespace ustdex
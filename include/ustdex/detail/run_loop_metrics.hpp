@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_RUN_LOOP_METRICS
+#define USTDEX_DETAIL_RUN_LOOP_METRICS
+
+#include "config.hpp"
+
+#if !defined(__CUDA_ARCH__)
+
+#  include <array>
+#  include <atomic>
+#  include <chrono>
+#  include <cstddef>
+#  include <cstdint>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+//! \brief The counts of a `latency_histogram` at one point in time.
+struct histogram_snapshot;
+
+//! \brief A histogram of durations in nanoseconds that threads can record
+//! into concurrently without locking.
+//!
+//! Like an HDR histogram, it has buckets of exact values up to
+//! `sub_buckets`, and above that, `sub_buckets` buckets for each power of
+//! two. A recorded value is therefore off by at most 1/`sub_buckets` of
+//! itself, over the whole range of `std::uint64_t`.
+class latency_histogram
+{
+public:
+  static constexpr std::size_t sub_bucket_bits = 3;
+  static constexpr std::size_t sub_buckets     = std::size_t(1) << sub_bucket_bits;
+  static constexpr std::size_t bucket_count    = (64 - sub_bucket_bits + 1) * sub_buckets;
+
+  //! \brief Returns the index of the bucket that counts `ns`.
+  USTDEX_API static constexpr auto bucket_of(std::uint64_t ns) noexcept -> std::size_t
+  {
+    if (ns < sub_buckets)
+    {
+      return static_cast<std::size_t>(ns);
+    }
+    const std::size_t _exp = _log2(ns);
+    const std::size_t _sub = static_cast<std::size_t>(ns >> (_exp - sub_bucket_bits)) & (sub_buckets - 1);
+    return (_exp - sub_bucket_bits + 1) * sub_buckets + _sub;
+  }
+
+  //! \brief Returns the smallest value that bucket `index` counts.
+  USTDEX_API static constexpr auto bucket_lower_bound(std::size_t index) noexcept -> std::uint64_t
+  {
+    if (index < sub_buckets)
+    {
+      return index;
+    }
+    const std::size_t _exp = index / sub_buckets + sub_bucket_bits - 1;
+    return static_cast<std::uint64_t>(sub_buckets + index % sub_buckets) << (_exp - sub_bucket_bits);
+  }
+
+  USTDEX_API void record(std::uint64_t ns) noexcept
+  {
+    _buckets_[bucket_of(ns)].fetch_add(1, std::memory_order_relaxed);
+    _sum_.fetch_add(ns, std::memory_order_relaxed);
+    std::uint64_t _max = _max_.load(std::memory_order_relaxed);
+    while (_max < ns && !_max_.compare_exchange_weak(_max, ns, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  USTDEX_API void record(std::chrono::nanoseconds duration) noexcept
+  {
+    record(duration.count() < 0 ? 0 : static_cast<std::uint64_t>(duration.count()));
+  }
+
+  USTDEX_API auto snapshot() const noexcept -> histogram_snapshot;
+
+private:
+  USTDEX_API static constexpr auto _log2(std::uint64_t _val) noexcept -> std::size_t
+  {
+#  if defined(__GNUC__)
+    return static_cast<std::size_t>(63 - __builtin_clzll(_val));
+#  else
+    std::size_t _exp = 0;
+    while (_val >>= 1)
+    {
+      ++_exp;
+    }
+    return _exp;
+#  endif
+  }
+
+  std::atomic<std::uint64_t> _buckets_[bucket_count]{};
+  std::atomic<std::uint64_t> _sum_{0};
+  std::atomic<std::uint64_t> _max_{0};
+};
+
+struct histogram_snapshot
+{
+  std::array<std::uint64_t, latency_histogram::bucket_count> buckets{};
+  std::uint64_t count  = 0;
+  std::uint64_t sum_ns = 0;
+  std::uint64_t max_ns = 0;
+
+  USTDEX_API auto mean_ns() const noexcept -> double
+  {
+    return count == 0 ? 0.0 : static_cast<double>(sum_ns) / static_cast<double>(count);
+  }
+
+  //! \brief Returns an upper bound of the `p`-th percentile, for `p` in
+  //! [0, 100]: the end of the bucket that holds it, or the largest recorded
+  //! value if that is smaller.
+  USTDEX_API auto percentile_ns(double p) const noexcept -> std::uint64_t
+  {
+    if (count == 0)
+    {
+      return 0;
+    }
+    const double _rank  = p / 100.0 * static_cast<double>(count);
+    std::uint64_t _seen = 0;
+    for (std::size_t _i = 0; _i < buckets.size(); ++_i)
+    {
+      _seen += buckets[_i];
+      if (_seen != 0 && static_cast<double>(_seen) >= _rank)
+      {
+        const std::uint64_t _end =
+          _i + 1 < buckets.size() ? latency_histogram::bucket_lower_bound(_i + 1) - 1 : ~std::uint64_t(0);
+        return _end < max_ns ? _end : max_ns;
+      }
+    }
+    return max_ns;
+  }
+};
+
+USTDEX_API inline auto latency_histogram::snapshot() const noexcept -> histogram_snapshot
+{
+  histogram_snapshot _snap;
+  for (std::size_t _i = 0; _i < bucket_count; ++_i)
+  {
+    _snap.buckets[_i] = _buckets_[_i].load(std::memory_order_relaxed);
+    _snap.count += _snap.buckets[_i];
+  }
+  _snap.sum_ns = _sum_.load(std::memory_order_relaxed);
+  _snap.max_ns = _max_.load(std::memory_order_relaxed);
+  return _snap;
+}
+
+//! \brief What a `run_loop` built with `USTDEX_ENABLE_RUN_LOOP_METRICS` has
+//! measured since it was created.
+struct run_loop_metrics
+{
+  //! The number of tasks queued when the snapshot was taken.
+  std::size_t queue_depth = 0;
+  //! The largest number of tasks that were ever queued at once.
+  std::size_t max_queue_depth = 0;
+  //! The time from queueing each task to the loop starting to run it.
+  histogram_snapshot queue_time;
+  //! The time each task ran for, until it returned to the loop.
+  histogram_snapshot execution_time;
+};
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
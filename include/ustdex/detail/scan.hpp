@@ -0,0 +1,347 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_SCAN
+#define USTDEX_DETAIL_SCAN
+
+#include "config.hpp"
+
+#if !defined(__CUDA_ARCH__)
+
+#  include "cpos.hpp"
+#  include "exception.hpp"
+#  include "exclusive_scan.hpp"
+#  include "parallel.hpp"
+#  include "trace.hpp"
+
+#  include <functional>
+#  include <iterator>
+#  include <memory>
+#  include <optional>
+#  include <type_traits>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+namespace _par
+{
+template <class Op, class Ty>
+inline constexpr bool _is_plus = USTDEX_IS_SAME(Op, std::plus<>) || USTDEX_IS_SAME(Op, std::plus<Ty>);
+
+// Reduces a non-empty chunk in the first pass of a scan. Arithmetic elements
+// that are added up go through four independent accumulators, which breaks the
+// loop-carried dependency so that the compiler can vectorize the loop.
+template <class Ty, class It, class Op>
+USTDEX_API auto _chunk_sum(It _first, It _last, Op& _op) -> Ty
+{
+  using _value_t = typename std::iterator_traits<It>::value_type;
+  if constexpr (std::is_arithmetic_v<Ty> && std::is_arithmetic_v<_value_t> && _is_plus<Op, Ty>)
+  {
+    const auto _size            = _last - _first;
+    Ty _lanes[4]                = {};
+    decltype(_last - _first) _i = 0;
+    for (; _i + 4 <= _size; _i += 4)
+    {
+      _lanes[0] += _first[_i];
+      _lanes[1] += _first[_i + 1];
+      _lanes[2] += _first[_i + 2];
+      _lanes[3] += _first[_i + 3];
+    }
+    Ty _sum = (_lanes[0] + _lanes[1]) + (_lanes[2] + _lanes[3]);
+    for (; _i < _size; ++_i)
+    {
+      _sum += _first[_i];
+    }
+    return _sum;
+  }
+  else
+  {
+    Ty _sum(*_first);
+    while (++_first != _last)
+    {
+      _sum = _op(static_cast<Ty&&>(_sum), *_first);
+    }
+    return _sum;
+  }
+}
+
+// The classic two-pass parallel scan. The first pass reduces every chunk but
+// the last. The sums are then scanned serially, which gives each chunk the
+// value to start from, and the second pass scans every chunk into the output.
+// On a scheduler without parallelism there is one chunk, and the first pass is
+// skipped.
+template <class Tag, bool Inclusive>
+struct _scan
+{
+protected:
+  template <class Rcvr, class Sch, class Rng, class OutIt, class Ty, class Op>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using _env_t                  = FWD_ENV_T<env_of_t<Rcvr>>;
+    using _fork_t                 = _par::_fork_t<Sch, _env_t, _opstate_t>;
+
+    USTDEX_API _opstate_t(Rcvr _rcvr, Sch _sch, Rng _rng, OutIt _out, std::optional<Ty> _init, Op _op)
+        : _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+        , _rng_{static_cast<Rng&&>(_rng)}
+        , _out_{static_cast<OutIt&&>(_out)}
+        , _init_{static_cast<std::optional<Ty>&&>(_init)}
+        , _op_{static_cast<Op&&>(_op)}
+        , _fork_{static_cast<Sch&&>(_sch), this}
+    {}
+
+    USTDEX_IMMOVABLE(_opstate_t);
+
+    USTDEX_API void start() & noexcept
+    {
+      ustdex::_trace_start(_rcvr_);
+      _size_  = static_cast<std::size_t>(std::distance(std::begin(_rng_), std::end(_rng_)));
+      _count_ = (std::min)(_par::_parallelism(_fork_._sch_), (std::max)(_size_, std::size_t(1)));
+      USTDEX_TRY
+      {
+        _carries_.reset(new std::optional<Ty>[_count_]);
+      }
+      USTDEX_CATCH(...)
+      {
+        ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+        return;
+      }
+
+      if (_count_ == 1)
+      {
+        _carries_[0] = static_cast<std::optional<Ty>&&>(_init_);
+        _second_pass_ = true;
+        _fork_._start(1);
+      }
+      else
+      {
+        _fork_._start(_count_ - 1);
+      }
+    }
+
+    USTDEX_API void _run(std::size_t _index)
+    {
+      auto [_begin, _end] = _par::_chunk(_size_, _count_, _index);
+      auto _first         = std::begin(_rng_) + _begin;
+      auto _last          = std::begin(_rng_) + _end;
+
+      if (!_second_pass_)
+      {
+        // The sum of chunk i is kept where the carry of chunk i + 1 goes.
+        _carries_[_index + 1].emplace(_par::_chunk_sum<Ty>(_first, _last, _op_));
+      }
+      else if constexpr (Inclusive)
+      {
+        if (_carries_[_index])
+        {
+          ustdex::_inclusive_scan(_first, _last, _out_ + _begin, _op_, static_cast<Ty&&>(*_carries_[_index]));
+        }
+        else
+        {
+          ustdex::_inclusive_scan(_first, _last, _out_ + _begin, _op_);
+        }
+      }
+      else
+      {
+        ustdex::_exclusive_scan(_first, _last, _out_ + _begin, static_cast<Ty&&>(*_carries_[_index]), _op_);
+      }
+    }
+
+    USTDEX_API void _join() noexcept
+    {
+      switch (_fork_._disposition())
+      {
+        case _value:
+          if (_second_pass_)
+          {
+            ustdex::set_value(static_cast<Rcvr&&>(_rcvr_), _out_ + _size_);
+          }
+          else
+          {
+            USTDEX_TRY
+            {
+              _scan_sums();
+            }
+            USTDEX_CATCH(...)
+            {
+              ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+              return;
+            }
+            _second_pass_ = true;
+            _fork_._start(_count_);
+          }
+          break;
+        case _error:
+          ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), static_cast<::std::exception_ptr&&>(_fork_._exception()));
+          break;
+        case _stopped:
+          ustdex::set_stopped(static_cast<Rcvr&&>(_rcvr_));
+          break;
+      }
+    }
+
+    // Turns the chunk sums into the values that each chunk starts from.
+    USTDEX_API void _scan_sums()
+    {
+      _carries_[0] = static_cast<std::optional<Ty>&&>(_init_);
+      for (std::size_t _i = 1; _i < _count_; ++_i)
+      {
+        if (_carries_[_i - 1])
+        {
+          _carries_[_i] = _op_(*_carries_[_i - 1], static_cast<Ty&&>(*_carries_[_i]));
+        }
+      }
+    }
+
+    USTDEX_API auto _env() const noexcept -> _env_t
+    {
+      return ustdex::get_env(_rcvr_);
+    }
+
+    Rcvr _rcvr_;
+    Rng _rng_;
+    OutIt _out_;
+    std::optional<Ty> _init_;
+    Op _op_;
+    std::size_t _size_  = 0;
+    std::size_t _count_ = 0;
+    bool _second_pass_  = false;
+    std::unique_ptr<std::optional<Ty>[]> _carries_{};
+    _fork_t _fork_;
+  };
+
+  template <class Sch, class Rng, class OutIt, class Ty, class Op>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _sndr_t
+  {
+    using sender_concept = sender_t;
+
+    template <class Self, class... Env>
+    USTDEX_API static constexpr auto get_completion_signatures()
+    {
+      return _par::_completions<Sch, set_value_t(OutIt), Env...>();
+    }
+
+    template <class Rcvr>
+    using _opstate_for_t = _opstate_t<_traced_rcvr_t<Tag, Rcvr>, Sch, Rng, OutIt, Ty, Op>;
+
+    template <class Rcvr>
+    USTDEX_API auto connect(Rcvr _rcvr) && -> _opstate_for_t<Rcvr>
+    {
+      return _opstate_for_t<Rcvr>{
+        ustdex::_trace_rcvr<Tag>(static_cast<Rcvr&&>(_rcvr)),
+        static_cast<Sch&&>(_sch_),
+        static_cast<Rng&&>(_rng_),
+        static_cast<OutIt&&>(_out_),
+        static_cast<std::optional<Ty>&&>(_init_),
+        static_cast<Op&&>(_op_)};
+    }
+
+    template <class Rcvr>
+    USTDEX_API auto connect(Rcvr _rcvr) const& -> _opstate_for_t<Rcvr>
+    {
+      return _opstate_for_t<Rcvr>{
+        ustdex::_trace_rcvr<Tag>(static_cast<Rcvr&&>(_rcvr)), _sch_, _rng_, _out_, _init_, _op_};
+    }
+
+    USTDEX_NO_UNIQUE_ADDRESS Tag _tag_;
+    Sch _sch_;
+    Rng _rng_;
+    OutIt _out_;
+    std::optional<Ty> _init_;
+    Op _op_;
+  };
+
+  // As with reduce, an lvalue range is referred to and an rvalue range is
+  // moved into the sender.
+  template <class Ty, class Sch, class Rng, class OutIt, class Op>
+  USTDEX_API static auto _make(Sch _sch, Rng&& _rng, OutIt _out, std::optional<Ty> _init, Op _op)
+    -> _sndr_t<Sch, Rng, OutIt, Ty, Op>
+  {
+    static_assert(_random_access_range<Rng>, "the parallel algorithms require a random-access range");
+    static_assert(_random_access_iterator<OutIt>, "the parallel scans require a random-access output iterator");
+    return _sndr_t<Sch, Rng, OutIt, Ty, Op>{
+      {},
+      static_cast<Sch&&>(_sch),
+      static_cast<Rng&&>(_rng),
+      static_cast<OutIt&&>(_out),
+      static_cast<std::optional<Ty>&&>(_init),
+      static_cast<Op&&>(_op)};
+  }
+};
+} // namespace _par
+
+//! \brief Returns a sender that writes the inclusive prefix scan of a
+//! random-access range with `_op` to `_out`, and completes with the end of the
+//! output. The first output is `_init` combined with the first element, or the
+//! first element itself when there is no `_init`. The scan runs in parallel on
+//! `_sch` when its domain supports it, so `_op` must be associative. `_out` may
+//! be the beginning of the input.
+struct inclusive_scan_t : _par::_scan<inclusive_scan_t, true>
+{
+  template <class Sch, class Rng, class OutIt, class Op = std::plus<>>
+  USTDEX_API auto operator()(Sch _sch, Rng&& _rng, OutIt _out, Op _op = {}) const
+  {
+    using _value_t = typename std::iterator_traits<_par::_iterator_t<Rng>>::value_type;
+    return _make<_value_t>(static_cast<Sch&&>(_sch),
+                           static_cast<Rng&&>(_rng),
+                           static_cast<OutIt&&>(_out),
+                           std::nullopt,
+                           static_cast<Op&&>(_op));
+  }
+
+  template <class Sch, class Rng, class OutIt, class Op, class Ty>
+  USTDEX_API auto operator()(Sch _sch, Rng&& _rng, OutIt _out, Op _op, Ty _init) const
+  {
+    return _make<Ty>(static_cast<Sch&&>(_sch),
+                     static_cast<Rng&&>(_rng),
+                     static_cast<OutIt&&>(_out),
+                     std::optional<Ty>{static_cast<Ty&&>(_init)},
+                     static_cast<Op&&>(_op));
+  }
+};
+
+//! \brief Like `inclusive_scan`, but the i-th output combines `_init` with the
+//! elements before the i-th element, not including it.
+struct exclusive_scan_t : _par::_scan<exclusive_scan_t, false>
+{
+  template <class Sch, class Rng, class OutIt, class Ty, class Op = std::plus<>>
+  USTDEX_API auto operator()(Sch _sch, Rng&& _rng, OutIt _out, Ty _init, Op _op = {}) const
+  {
+    return _make<Ty>(static_cast<Sch&&>(_sch),
+                     static_cast<Rng&&>(_rng),
+                     static_cast<OutIt&&>(_out),
+                     std::optional<Ty>{static_cast<Ty&&>(_init)},
+                     static_cast<Op&&>(_op));
+  }
+};
+
+inline constexpr inclusive_scan_t inclusive_scan{};
+inline constexpr exclusive_scan_t exclusive_scan{};
+
+template <>
+inline constexpr const char* trace_name_v<inclusive_scan_t> = "inclusive_scan";
+
+template <>
+inline constexpr const char* trace_name_v<exclusive_scan_t> = "exclusive_scan";
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
@@ -0,0 +1,440 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_SORT
+#define USTDEX_DETAIL_SORT
+
+#include "config.hpp"
+
+#if !defined(__CUDA_ARCH__)
+
+#  include "cpos.hpp"
+#  include "exception.hpp"
+#  include "parallel.hpp"
+#  include "trace.hpp"
+
+#  include <algorithm>
+#  include <functional>
+#  include <iterator>
+#  include <memory>
+#  include <new> // IWYU pragma: keep
+#  include <type_traits>
+#  include <utility>
+#  include <vector>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+namespace _par
+{
+template <class Cmp, class Ty>
+inline constexpr bool _is_less = USTDEX_IS_SAME(Cmp, std::less<>) || USTDEX_IS_SAME(Cmp, std::less<Ty>);
+
+// Integral keys compared with std::less are sorted with a radix sort, except in
+// chunks too small to repay its passes over the data.
+template <class Ty, class Cmp>
+inline constexpr bool _use_radix_sort = std::is_integral_v<Ty> && !USTDEX_IS_SAME(Ty, bool) && _is_less<Cmp, Ty>;
+
+inline constexpr std::size_t _radix_sort_threshold = 1024;
+
+// The byte of a key that a radix sort pass looks at. Flipping the sign bit of
+// signed keys makes the negative ones sort first.
+template <class Ty>
+USTDEX_API auto _radix_digit(Ty _key, unsigned _shift) noexcept -> std::size_t
+{
+  using _bits_t           = std::make_unsigned_t<Ty>;
+  constexpr _bits_t _flip = std::is_signed_v<Ty> ? _bits_t(_bits_t(1) << (8 * sizeof(Ty) - 1)) : _bits_t(0);
+  return static_cast<std::size_t>((static_cast<_bits_t>(static_cast<_bits_t>(_key) ^ _flip) >> _shift) & 0xff);
+}
+
+// Scatters `_size` keys from `_src` to `_dst`, ordered by one byte. Returns
+// false without moving anything when all keys have the same byte.
+template <class Ty, class SrcIt, class DstIt>
+USTDEX_API auto _radix_pass(SrcIt _src, std::size_t _size, DstIt _dst, unsigned _shift) noexcept -> bool
+{
+  std::size_t _counts[256] = {};
+  for (std::size_t _i = 0; _i < _size; ++_i)
+  {
+    ++_counts[_par::_radix_digit<Ty>(_src[_i], _shift)];
+  }
+
+  std::size_t _offset = 0;
+  for (auto& _count : _counts)
+  {
+    if (_count == _size)
+    {
+      return false;
+    }
+    _offset += std::exchange(_count, _offset);
+  }
+
+  for (std::size_t _i = 0; _i < _size; ++_i)
+  {
+    _dst[_counts[_par::_radix_digit<Ty>(_src[_i], _shift)]++] = _src[_i];
+  }
+  return true;
+}
+
+// A least-significant-digit radix sort, one byte per pass, that uses `_buffer`
+// as scratch space.
+template <class It, class Ty>
+USTDEX_API void _radix_sort(It _first, It _last, Ty* _buffer) noexcept
+{
+  const auto _size = static_cast<std::size_t>(_last - _first);
+  bool _in_buffer  = false;
+  for (unsigned _shift = 0; _shift < 8 * sizeof(Ty); _shift += 8)
+  {
+    if (_in_buffer ? _par::_radix_pass<Ty>(_buffer, _size, _first, _shift)
+                   : _par::_radix_pass<Ty>(_first, _size, _buffer, _shift))
+    {
+      _in_buffer = !_in_buffer;
+    }
+  }
+
+  if (_in_buffer)
+  {
+    std::copy(_buffer, _buffer + _size, _first);
+  }
+}
+
+template <class It, class Cmp, class Ty>
+USTDEX_API void _sort_chunk(It _first, It _last, Cmp& _cmp, Ty* _buffer)
+{
+  if constexpr (_use_radix_sort<Ty, Cmp>)
+  {
+    if (static_cast<std::size_t>(_last - _first) >= _radix_sort_threshold)
+    {
+      _par::_radix_sort(_first, _last, _buffer);
+      return;
+    }
+  }
+  std::sort(_first, _last, _cmp);
+}
+
+// Picks one splitter per bucket boundary from evenly spaced samples of the `_k`
+// sorted chunks of the `_size` elements at `_first`. Then finds where each of
+// the `_k` buckets starts in each chunk, in `_bounds[_j * _k + _i]`, and in the
+// output, in `_offsets[_j]`. Elements are ordered by value and then by
+// position, so that runs of equal elements are divided between buckets like
+// any others rather than all landing in one.
+template <class It, class Cmp>
+USTDEX_API void _split(It _first, std::size_t _size, std::size_t _k, Cmp& _cmp, std::size_t* _bounds, std::size_t* _offsets)
+{
+  auto _bound = [&](std::size_t _j, std::size_t _i) -> std::size_t& {
+    return _bounds[_j * _k + _i];
+  };
+
+  std::vector<std::size_t> _samples;
+  _samples.reserve(_k * (_k - 1));
+  for (std::size_t _i = 0; _i < _k; ++_i)
+  {
+    auto [_begin, _end] = _par::_chunk(_size, _k, _i);
+    _bound(0, _i)       = _begin;
+    _bound(_k, _i)      = _end;
+    for (std::size_t _s = 1; _s < _k; ++_s)
+    {
+      _samples.push_back(_begin + (_end - _begin) * _s / _k);
+    }
+  }
+  std::sort(_samples.begin(), _samples.end(), [&](std::size_t _a, std::size_t _b) {
+    return _cmp(_first[_a], _first[_b]) || (!_cmp(_first[_b], _first[_a]) && _a < _b);
+  });
+
+  _offsets[0] = 0;
+  for (std::size_t _j = 1; _j < _k; ++_j)
+  {
+    // The bucket starts at the first element ordered after the splitter: the
+    // splitter's equal run goes to the bucket before it up to the splitter's
+    // own position, and to this bucket after it.
+    const std::size_t _pos = _samples[_j * _samples.size() / _k];
+    auto&& _splitter       = _first[_pos];
+    _offsets[_j]           = 0;
+    for (std::size_t _i = 0; _i < _k; ++_i)
+    {
+      auto _lo = std::lower_bound(_first + _bound(_j - 1, _i), _first + _bound(_k, _i), _splitter, _cmp);
+      auto _hi = std::upper_bound(_lo, _first + _bound(_k, _i), _splitter, _cmp);
+      _bound(_j, _i) =
+        (std::clamp)(_pos + 1, static_cast<std::size_t>(_lo - _first), static_cast<std::size_t>(_hi - _first));
+      _offsets[_j] += _bound(_j, _i) - _bound(0, _i);
+    }
+  }
+  _offsets[_k] = _size;
+}
+} // namespace _par
+
+//! \brief Returns a sender that sorts a random-access range in place with
+//! `_cmp`, and completes with no values. The sort is not stable.
+//!
+//! When the domain of `_sch` supports parallelism, each worker sorts one
+//! chunk of the range, and the sorted chunks are then merged in parallel:
+//! splitters sampled at regular intervals from the chunks divide the output
+//! into one bucket per worker, and each worker merges the parts of all chunks
+//! that fall into its bucket. Integral keys compared with `std::less` are
+//! sorted with a radix sort. An lvalue range is sorted where it is; an rvalue
+//! range, which should be a view, is moved into the sender.
+struct sort_t
+{
+private:
+  template <class Rcvr, class Sch, class Rng, class Cmp>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using _env_t                  = FWD_ENV_T<env_of_t<Rcvr>>;
+    using _fork_t                 = _par::_fork_t<Sch, _env_t, _opstate_t>;
+    using _value_t                = typename std::iterator_traits<_par::_iterator_t<Rng>>::value_type;
+
+    enum _phase_t
+    {
+      _sorting,
+      _merging,
+      _copying
+    };
+
+    USTDEX_API _opstate_t(Rcvr _rcvr, Sch _sch, Rng _rng, Cmp _cmp)
+        : _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+        , _rng_{static_cast<Rng&&>(_rng)}
+        , _cmp_{static_cast<Cmp&&>(_cmp)}
+        , _fork_{static_cast<Sch&&>(_sch), this}
+    {}
+
+    USTDEX_IMMOVABLE(_opstate_t);
+
+    USTDEX_API ~_opstate_t()
+    {
+      if (_buffer_ != nullptr)
+      {
+        for (std::size_t _j = 0; _built_ && _j < _count_; ++_j)
+        {
+          std::destroy_n(_buffer_ + _offsets_[_j], _built_[_j]);
+        }
+        std::allocator<_value_t>().deallocate(_buffer_, _size_);
+      }
+    }
+
+    USTDEX_API void start() & noexcept
+    {
+      ustdex::_trace_start(_rcvr_);
+      _size_  = static_cast<std::size_t>(std::distance(std::begin(_rng_), std::end(_rng_)));
+      _count_ = (std::min)(_par::_parallelism(_fork_._sch_), (std::max)(_size_, std::size_t(1)));
+      USTDEX_TRY
+      {
+        if (_count_ > 1 || (_par::_use_radix_sort<_value_t, Cmp> && _size_ >= _par::_radix_sort_threshold))
+        {
+          _buffer_ = std::allocator<_value_t>().allocate(_size_);
+        }
+      }
+      USTDEX_CATCH(...)
+      {
+        ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+        return;
+      }
+      _fork_._start(_count_);
+    }
+
+    USTDEX_API void _run(std::size_t _index)
+    {
+      switch (_phase_)
+      {
+        case _sorting: {
+          auto [_begin, _end] = _par::_chunk(_size_, _count_, _index);
+          auto _first         = std::begin(_rng_);
+          _par::_sort_chunk(_first + _begin, _first + _end, _cmp_, _buffer_ + _begin);
+          break;
+        }
+        case _merging:
+          _merge(_index);
+          break;
+        case _copying:
+          _copy_back(_index);
+          break;
+      }
+    }
+
+    USTDEX_API void _join() noexcept
+    {
+      switch (_fork_._disposition())
+      {
+        case _value:
+          if (_phase_ == _copying || _count_ == 1)
+          {
+            ustdex::set_value(static_cast<Rcvr&&>(_rcvr_));
+          }
+          else
+          {
+            if (_phase_ == _sorting)
+            {
+              USTDEX_TRY
+              {
+                _split();
+              }
+              USTDEX_CATCH(...)
+              {
+                ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+                return;
+              }
+            }
+            _phase_ = _phase_ == _sorting ? _merging : _copying;
+            _fork_._start(_count_);
+          }
+          break;
+        case _error:
+          ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), static_cast<::std::exception_ptr&&>(_fork_._exception()));
+          break;
+        case _stopped:
+          ustdex::set_stopped(static_cast<Rcvr&&>(_rcvr_));
+          break;
+      }
+    }
+
+    // Where bucket `_j` starts in the sorted chunk `_i`.
+    USTDEX_API auto _bound(std::size_t _j, std::size_t _i) noexcept -> std::size_t&
+    {
+      return _bounds_[_j * _count_ + _i];
+    }
+
+    USTDEX_API void _split()
+    {
+      _bounds_.reset(new std::size_t[(_count_ + 1) * _count_]);
+      _offsets_.reset(new std::size_t[_count_ + 1]);
+      _built_.reset(new std::size_t[_count_]());
+      _par::_split(std::begin(_rng_), _size_, _count_, _cmp_, _bounds_.get(), _offsets_.get());
+    }
+
+    // Merges the parts of all sorted chunks that fall into bucket `_j` into
+    // the buffer, using a heap of the parts that have elements left.
+    USTDEX_API void _merge(std::size_t _j)
+    {
+      auto _first = std::begin(_rng_);
+      std::vector<std::pair<std::size_t, std::size_t>> _heads;
+      for (std::size_t _i = 0; _i < _count_; ++_i)
+      {
+        if (_bound(_j, _i) != _bound(_j + 1, _i))
+        {
+          _heads.emplace_back(_bound(_j, _i), _bound(_j + 1, _i));
+        }
+      }
+
+      auto _later = [&](const auto& _a, const auto& _b) {
+        return _cmp_(_first[_b.first], _first[_a.first]);
+      };
+      std::make_heap(_heads.begin(), _heads.end(), _later);
+
+      _value_t* _out = _buffer_ + _offsets_[_j];
+      while (!_heads.empty())
+      {
+        std::pop_heap(_heads.begin(), _heads.end(), _later);
+        auto& _head = _heads.back();
+        ::new (static_cast<void*>(_out++)) _value_t(static_cast<_value_t&&>(_first[_head.first]));
+        ++_built_[_j];
+        if (++_head.first == _head.second)
+        {
+          _heads.pop_back();
+        }
+        else
+        {
+          std::push_heap(_heads.begin(), _heads.end(), _later);
+        }
+      }
+    }
+
+    USTDEX_API void _copy_back(std::size_t _j)
+    {
+      _value_t* _src = _buffer_ + _offsets_[_j];
+      std::move(_src, _src + _built_[_j], std::begin(_rng_) + _offsets_[_j]);
+      std::destroy_n(_src, std::exchange(_built_[_j], 0));
+    }
+
+    USTDEX_API auto _env() const noexcept -> _env_t
+    {
+      return ustdex::get_env(_rcvr_);
+    }
+
+    Rcvr _rcvr_;
+    Rng _rng_;
+    Cmp _cmp_;
+    std::size_t _size_  = 0;
+    std::size_t _count_ = 0;
+    _phase_t _phase_    = _sorting;
+    _value_t* _buffer_  = nullptr;
+    std::unique_ptr<std::size_t[]> _bounds_{};
+    std::unique_ptr<std::size_t[]> _offsets_{};
+    std::unique_ptr<std::size_t[]> _built_{};
+    _fork_t _fork_;
+  };
+
+  template <class Sch, class Rng, class Cmp>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _sndr_t;
+
+public:
+  template <class Sch, class Rng, class Cmp = std::less<>>
+  USTDEX_API auto operator()(Sch _sch, Rng&& _rng, Cmp _cmp = {}) const -> _sndr_t<Sch, Rng, Cmp>;
+};
+
+template <class Sch, class Rng, class Cmp>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT sort_t::_sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class Self, class... Env>
+  USTDEX_API static constexpr auto get_completion_signatures()
+  {
+    return _par::_completions<Sch, set_value_t(), Env...>();
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) && -> _opstate_t<_traced_rcvr_t<sort_t, Rcvr>, Sch, Rng, Cmp>
+  {
+    return _opstate_t<_traced_rcvr_t<sort_t, Rcvr>, Sch, Rng, Cmp>{
+      ustdex::_trace_rcvr<sort_t>(static_cast<Rcvr&&>(_rcvr)),
+      static_cast<Sch&&>(_sch_),
+      static_cast<Rng&&>(_rng_),
+      static_cast<Cmp&&>(_cmp_)};
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) const& -> _opstate_t<_traced_rcvr_t<sort_t, Rcvr>, Sch, Rng, Cmp>
+  {
+    return _opstate_t<_traced_rcvr_t<sort_t, Rcvr>, Sch, Rng, Cmp>{
+      ustdex::_trace_rcvr<sort_t>(static_cast<Rcvr&&>(_rcvr)), _sch_, _rng_, _cmp_};
+  }
+
+  USTDEX_NO_UNIQUE_ADDRESS sort_t _tag_;
+  Sch _sch_;
+  Rng _rng_;
+  Cmp _cmp_;
+};
+
+template <class Sch, class Rng, class Cmp>
+USTDEX_API auto sort_t::operator()(Sch _sch, Rng&& _rng, Cmp _cmp) const -> _sndr_t<Sch, Rng, Cmp>
+{
+  static_assert(_par::_random_access_range<Rng>, "the parallel algorithms require a random-access range");
+  return _sndr_t<Sch, Rng, Cmp>{
+    {}, static_cast<Sch&&>(_sch), static_cast<Rng&&>(_rng), static_cast<Cmp&&>(_cmp)};
+}
+
+inline constexpr sort_t sort{};
+
+template <>
+inline constexpr const char* trace_name_v<sort_t> = "sort";
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
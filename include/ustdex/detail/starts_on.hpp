@@ -23,6 +23,7 @@
 #include "queries.hpp"
 #include "rcvr_ref.hpp"
 #include "rcvr_with_env.hpp"
+#include "trace.hpp"
 
 #include "prologue.hpp"
 
@@ -59,6 +60,7 @@ private:
 
     USTDEX_API void start() noexcept
     {
+      ustdex::_trace_start(this->base());
       ustdex::start(_opstate1_);
     }
 
@@ -85,6 +87,9 @@ public:
     -> _sndr_t<Sch, Sndr>;
 } starts_on{};
 
+template <>
+inline constexpr const char* trace_name_v<start_on_t> = "starts_on";
+
 template <class Sch, class Sndr>
 struct USTDEX_TYPE_VISIBILITY_DEFAULT start_on_t::_sndr_t
 {
@@ -111,15 +116,17 @@ struct USTDEX_TYPE_VISIBILITY_DEFAULT start_on_t::_sndr_t
   }
 
   template <class Rcvr>
-  USTDEX_API auto connect(Rcvr _rcvr) && -> _opstate_t<Rcvr, Sch, Sndr>
+  USTDEX_API auto connect(Rcvr _rcvr) && -> _opstate_t<_traced_rcvr_t<start_on_t, Rcvr>, Sch, Sndr>
   {
-    return _opstate_t<Rcvr, Sch, Sndr>{_sch_, static_cast<Rcvr&&>(_rcvr), static_cast<Sndr&&>(_sndr_)};
+    return _opstate_t<_traced_rcvr_t<start_on_t, Rcvr>, Sch, Sndr>{
+      _sch_, ustdex::_trace_rcvr<start_on_t>(static_cast<Rcvr&&>(_rcvr)), static_cast<Sndr&&>(_sndr_)};
   }
 
   template <class Rcvr>
-  USTDEX_API auto connect(Rcvr _rcvr) const& -> _opstate_t<Rcvr, Sch, const Sndr&>
+  USTDEX_API auto connect(Rcvr _rcvr) const& -> _opstate_t<_traced_rcvr_t<start_on_t, Rcvr>, Sch, const Sndr&>
   {
-    return _opstate_t<Rcvr, Sch, const Sndr&>{_sch_, static_cast<Rcvr&&>(_rcvr), _sndr_};
+    return _opstate_t<_traced_rcvr_t<start_on_t, Rcvr>, Sch, const Sndr&>{
+      _sch_, ustdex::_trace_rcvr<start_on_t>(static_cast<Rcvr&&>(_rcvr)), _sndr_};
   }
 
   USTDEX_API env_of_t<Sndr> get_env() const noexcept
@@ -21,6 +21,7 @@
 #include "config.hpp"
 
 #include "atomic.hpp"
+#include "lock_profile.hpp"
 #include "thread.hpp"
 #include "utility.hpp"
 
@@ -98,6 +99,12 @@ struct _spin_wait
 
   USTDEX_API void _wait() noexcept
   {
+#if USTDEX_LOCK_PROFILING()
+    if (_spins_++ == 0)
+    {
+      _since_ = std::chrono::steady_clock::now();
+    }
+#endif
     if (_count_ == 0)
     {
       ustdex::_this_thread_yield();
@@ -109,9 +116,23 @@ struct _spin_wait
     }
   }
 
+#if USTDEX_LOCK_PROFILING()
+  //! Records an acquisition of `_profile` after this spin wait.
+  USTDEX_API void _record(_lock_profile& _profile) const noexcept
+  {
+    _profile._record(_spins_ != 0,
+                     _spins_,
+                     _spins_ != 0 ? std::chrono::steady_clock::now() - _since_ : std::chrono::nanoseconds(0));
+  }
+#endif
+
 private:
   static constexpr uint32_t _yield_threshold = 20;
   uint32_t _count_                           = _yield_threshold;
+#if USTDEX_LOCK_PROFILING()
+  std::uint64_t _spins_ = 0;
+  std::chrono::steady_clock::time_point _since_{};
+#endif
 };
 
 template <template <class> class>
@@ -193,6 +214,9 @@ private:
   mutable ustd::atomic<uint8_t> _state_{0};
   mutable _stok::_inplace_stop_callback_base* _callbacks_ = nullptr;
   ustdex::_thread_id _notifying_thread_;
+#if USTDEX_LOCK_PROFILING()
+  mutable _lock_profile _profile_{"inplace_stop_source", this};
+#endif
 };
 
 // [stoptoken.inplace], class inplace_stop_token
@@ -370,6 +394,9 @@ USTDEX_API inline auto inplace_stop_source::_lock() const noexcept -> uint8_t
   } while (!_state_.compare_exchange_weak(
     _old_state, _old_state | _locked_flag, ustd::memory_order_acquire, ustd::memory_order_relaxed));
 
+#if USTDEX_LOCK_PROFILING()
+  _spin._record(_profile_);
+#endif
   return _old_state;
 }
 
@@ -409,6 +436,9 @@ USTDEX_API inline auto inplace_stop_source::_try_lock_unless_stop_requested(bool
     ustd::memory_order_relaxed));
 
   // Lock acquired successfully
+#if USTDEX_LOCK_PROFILING()
+  _spin._record(_profile_);
+#endif
   return true;
 }
 
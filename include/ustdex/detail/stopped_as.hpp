@@ -0,0 +1,375 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_STOPPED_AS
+#define USTDEX_DETAIL_STOPPED_AS
+
+#include "completion_signatures.hpp"
+#include "concepts.hpp"
+#include "cpos.hpp"
+#include "exception.hpp"
+#include "meta.hpp"
+#include "rcvr_ref.hpp"
+#include "trace.hpp"
+
+#include <optional>
+
+#include "prologue.hpp"
+
+namespace ustdex
+{
+struct SENDER_MUST_HAVE_ONE_VALUE_COMPLETION_WITH_ONE_ARGUMENT;
+
+// True when a sender's value types are exactly one completion with one value.
+template <class ValueTypes>
+inline constexpr bool _is_single_value = false;
+
+template <class Ty>
+inline constexpr bool _is_single_value<_m_list<_m_list<Ty>>> = true;
+
+template <class Ty>
+using _decayed_optional = std::optional<USTDEX_DECAY(Ty)>;
+
+struct stopped_as_optional_t
+{
+private:
+  template <class Rcvr, class CvSndr>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using _env_t                  = FWD_ENV_T<env_of_t<Rcvr>>;
+    using _optional_t = _value_types<completion_signatures_of_t<CvSndr, _env_t>, _decayed_optional, _identity_t>;
+
+    USTDEX_API _opstate_t(CvSndr&& _sndr, Rcvr _rcvr)
+        : _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+        , _opstate_{ustdex::connect(static_cast<CvSndr&&>(_sndr), _rcvr_ref{*this})}
+    {}
+
+    USTDEX_IMMOVABLE(_opstate_t);
+
+    USTDEX_API void start() & noexcept
+    {
+      ustdex::_trace_start(_rcvr_);
+      ustdex::start(_opstate_);
+    }
+
+    template <class Ty>
+    USTDEX_API void set_value(Ty&& _value) noexcept
+    {
+      if constexpr (_nothrow_decay_copyable<Ty>)
+      {
+        ustdex::set_value(static_cast<Rcvr&&>(_rcvr_), _optional_t{std::in_place, static_cast<Ty&&>(_value)});
+      }
+      else
+      {
+        USTDEX_TRY
+        {
+          ustdex::set_value(static_cast<Rcvr&&>(_rcvr_), _optional_t{std::in_place, static_cast<Ty&&>(_value)});
+        }
+        USTDEX_CATCH(...)
+        {
+          ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), ::std::current_exception());
+        }
+      }
+    }
+
+    template <class Error>
+    USTDEX_API void set_error(Error&& _error) noexcept
+    {
+      ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), static_cast<Error&&>(_error));
+    }
+
+    USTDEX_API void set_stopped() noexcept
+    {
+      ustdex::set_value(static_cast<Rcvr&&>(_rcvr_), _optional_t{});
+    }
+
+    USTDEX_API auto get_env() const noexcept -> _env_t
+    {
+      return ustdex::get_env(_rcvr_);
+    }
+
+    Rcvr _rcvr_;
+    connect_result_t<CvSndr, _rcvr_ref<_opstate_t, _env_t>> _opstate_;
+  };
+
+  template <class Sndr>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _sndr_t;
+
+  struct _closure_t
+  {
+    template <class Sndr>
+    USTDEX_TRIVIAL_API auto operator()(Sndr _sndr) const -> _call_result_t<stopped_as_optional_t, Sndr>
+    {
+      return stopped_as_optional_t()(static_cast<Sndr&&>(_sndr));
+    }
+
+    template <class Sndr>
+    USTDEX_TRIVIAL_API friend auto operator|(Sndr _sndr, _closure_t) -> _call_result_t<stopped_as_optional_t, Sndr>
+    {
+      return stopped_as_optional_t()(static_cast<Sndr&&>(_sndr));
+    }
+  };
+
+public:
+  //! \brief Adapts a sender that sends a single value into one that sends
+  //! the decayed value in a `std::optional`, and an empty `std::optional`
+  //! instead of completing with `set_stopped`.
+  template <class Sndr>
+  USTDEX_TRIVIAL_API auto operator()(Sndr _sndr) const noexcept -> _sndr_t<Sndr>;
+
+  USTDEX_TRIVIAL_API auto operator()() const noexcept -> _closure_t
+  {
+    return {};
+  }
+};
+
+template <class Sndr>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT stopped_as_optional_t::_sndr_t
+{
+  using sender_concept = sender_t;
+  USTDEX_NO_UNIQUE_ADDRESS stopped_as_optional_t _tag_;
+  Sndr _sndr_;
+
+  template <class Self, class... Env>
+  USTDEX_API static constexpr auto get_completion_signatures()
+  {
+    USTDEX_LET(auto _child_completions = get_child_completion_signatures<Self, Sndr, Env...>())
+    {
+      using _completions = decltype(_child_completions);
+      if constexpr (!_is_single_value<_value_types<_completions, _m_list, _m_list>>)
+      {
+        return invalid_completion_signature<WHERE(IN_ALGORITHM, stopped_as_optional_t),
+                                            WHAT(SENDER_MUST_HAVE_ONE_VALUE_COMPLETION_WITH_ONE_ARGUMENT),
+                                            WITH_SENDER(Sndr)>();
+      }
+      else
+      {
+        using _optional_t       = _value_types<_completions, _decayed_optional, _identity_t>;
+        constexpr bool _nothrow = _partitioned_completions_of<_completions>::_nothrow_decay_copyable::_values::value;
+        return transform_completion_signatures(_child_completions, _swallow_transform(), {}, _swallow_transform())
+             + completion_signatures<set_value_t(_optional_t)>() + _eptr_completion_if<!_nothrow>();
+      }
+    }
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) && //
+    noexcept(_nothrow_constructible<_opstate_t<_traced_rcvr_t<stopped_as_optional_t, Rcvr>, Sndr>,
+                                    Sndr,
+                                    _traced_rcvr_t<stopped_as_optional_t, Rcvr>>) //
+    -> _opstate_t<_traced_rcvr_t<stopped_as_optional_t, Rcvr>, Sndr>
+  {
+    return _opstate_t<_traced_rcvr_t<stopped_as_optional_t, Rcvr>, Sndr>{
+      static_cast<Sndr&&>(_sndr_), ustdex::_trace_rcvr<stopped_as_optional_t>(static_cast<Rcvr&&>(_rcvr))};
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) const& //
+    noexcept(_nothrow_constructible<_opstate_t<_traced_rcvr_t<stopped_as_optional_t, Rcvr>, const Sndr&>,
+                                    const Sndr&,
+                                    _traced_rcvr_t<stopped_as_optional_t, Rcvr>>) //
+    -> _opstate_t<_traced_rcvr_t<stopped_as_optional_t, Rcvr>, const Sndr&>
+  {
+    return _opstate_t<_traced_rcvr_t<stopped_as_optional_t, Rcvr>, const Sndr&>{
+      _sndr_, ustdex::_trace_rcvr<stopped_as_optional_t>(static_cast<Rcvr&&>(_rcvr))};
+  }
+
+  USTDEX_API env_of_t<Sndr> get_env() const noexcept
+  {
+    return ustdex::get_env(_sndr_);
+  }
+};
+
+template <class Sndr>
+USTDEX_TRIVIAL_API auto stopped_as_optional_t::operator()(Sndr _sndr) const noexcept -> _sndr_t<Sndr>
+{
+  // If the incoming sender is non-dependent, we can check the completion
+  // signatures of the composed sender immediately.
+  if constexpr (!dependent_sender<Sndr>)
+  {
+    using _completions = completion_signatures_of_t<_sndr_t<Sndr>>;
+    static_assert(_valid_completion_signatures<_completions>);
+  }
+  return _sndr_t<Sndr>{{}, static_cast<Sndr&&>(_sndr)};
+}
+
+struct stopped_as_error_t
+{
+private:
+  template <class Rcvr, class CvSndr, class Error>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using _env_t                  = FWD_ENV_T<env_of_t<Rcvr>>;
+
+    USTDEX_API _opstate_t(CvSndr&& _sndr, Rcvr _rcvr, Error _err)
+        : _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+        , _err_{static_cast<Error&&>(_err)}
+        , _opstate_{ustdex::connect(static_cast<CvSndr&&>(_sndr), _rcvr_ref{*this})}
+    {}
+
+    USTDEX_IMMOVABLE(_opstate_t);
+
+    USTDEX_API void start() & noexcept
+    {
+      ustdex::_trace_start(_rcvr_);
+      ustdex::start(_opstate_);
+    }
+
+    template <class... As>
+    USTDEX_API void set_value(As&&... _as) noexcept
+    {
+      ustdex::set_value(static_cast<Rcvr&&>(_rcvr_), static_cast<As&&>(_as)...);
+    }
+
+    template <class OtherError>
+    USTDEX_API void set_error(OtherError&& _error) noexcept
+    {
+      ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), static_cast<OtherError&&>(_error));
+    }
+
+    USTDEX_API void set_stopped() noexcept
+    {
+      ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), static_cast<Error&&>(_err_));
+    }
+
+    USTDEX_API auto get_env() const noexcept -> _env_t
+    {
+      return ustdex::get_env(_rcvr_);
+    }
+
+    Rcvr _rcvr_;
+    Error _err_;
+    connect_result_t<CvSndr, _rcvr_ref<_opstate_t, _env_t>> _opstate_;
+  };
+
+  template <class Sndr, class Error>
+  struct USTDEX_TYPE_VISIBILITY_DEFAULT _sndr_t;
+
+  template <class Error>
+  struct _closure_t
+  {
+    Error _err_;
+
+    template <class Sndr>
+    USTDEX_TRIVIAL_API auto operator()(Sndr _sndr) -> _call_result_t<stopped_as_error_t, Sndr, Error>
+    {
+      return stopped_as_error_t()(static_cast<Sndr&&>(_sndr), static_cast<Error&&>(_err_));
+    }
+
+    template <class Sndr>
+    USTDEX_TRIVIAL_API friend auto operator|(Sndr _sndr, _closure_t&& _self) //
+      -> _call_result_t<stopped_as_error_t, Sndr, Error>
+    {
+      return stopped_as_error_t()(static_cast<Sndr&&>(_sndr), static_cast<Error&&>(_self._err_));
+    }
+  };
+
+public:
+  //! \brief Adapts a sender so that it completes with `set_error(err)`
+  //! instead of `set_stopped()`.
+  template <class Sndr, class Error>
+  USTDEX_TRIVIAL_API auto operator()(Sndr _sndr, Error _err) const noexcept -> _sndr_t<Sndr, Error>;
+
+  template <class Error>
+  USTDEX_TRIVIAL_API auto operator()(Error _err) const noexcept -> _closure_t<Error>
+  {
+    return _closure_t<Error>{static_cast<Error&&>(_err)};
+  }
+};
+
+template <class Sndr, class Error>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT stopped_as_error_t::_sndr_t
+{
+  using sender_concept = sender_t;
+  USTDEX_NO_UNIQUE_ADDRESS stopped_as_error_t _tag_;
+  Error _err_;
+  Sndr _sndr_;
+
+  template <class Self, class... Env>
+  USTDEX_API static constexpr auto get_completion_signatures()
+  {
+    USTDEX_LET(auto _child_completions = get_child_completion_signatures<Self, Sndr, Env...>())
+    {
+      if constexpr (_child_completions.count(set_stopped) == 0)
+      {
+        return _child_completions;
+      }
+      else
+      {
+        return transform_completion_signatures(_child_completions, {}, {}, _swallow_transform())
+             + completion_signatures<set_error_t(Error)>();
+      }
+    }
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) && //
+    noexcept(_nothrow_constructible<_opstate_t<_traced_rcvr_t<stopped_as_error_t, Rcvr>, Sndr, Error>,
+                                    Sndr,
+                                    _traced_rcvr_t<stopped_as_error_t, Rcvr>,
+                                    Error>) //
+    -> _opstate_t<_traced_rcvr_t<stopped_as_error_t, Rcvr>, Sndr, Error>
+  {
+    return _opstate_t<_traced_rcvr_t<stopped_as_error_t, Rcvr>, Sndr, Error>{
+      static_cast<Sndr&&>(_sndr_),
+      ustdex::_trace_rcvr<stopped_as_error_t>(static_cast<Rcvr&&>(_rcvr)),
+      static_cast<Error&&>(_err_)};
+  }
+
+  template <class Rcvr>
+  USTDEX_API auto connect(Rcvr _rcvr) const& //
+    noexcept(_nothrow_constructible<_opstate_t<_traced_rcvr_t<stopped_as_error_t, Rcvr>, const Sndr&, Error>,
+                                    const Sndr&,
+                                    _traced_rcvr_t<stopped_as_error_t, Rcvr>,
+                                    const Error&>) //
+    -> _opstate_t<_traced_rcvr_t<stopped_as_error_t, Rcvr>, const Sndr&, Error>
+  {
+    return _opstate_t<_traced_rcvr_t<stopped_as_error_t, Rcvr>, const Sndr&, Error>{
+      _sndr_, ustdex::_trace_rcvr<stopped_as_error_t>(static_cast<Rcvr&&>(_rcvr)), _err_};
+  }
+
+  USTDEX_API env_of_t<Sndr> get_env() const noexcept
+  {
+    return ustdex::get_env(_sndr_);
+  }
+};
+
+template <class Sndr, class Error>
+USTDEX_TRIVIAL_API auto stopped_as_error_t::operator()(Sndr _sndr, Error _err) const noexcept -> _sndr_t<Sndr, Error>
+{
+  if constexpr (!dependent_sender<Sndr>)
+  {
+    using _completions = completion_signatures_of_t<_sndr_t<Sndr, Error>>;
+    static_assert(_valid_completion_signatures<_completions>);
+  }
+  return _sndr_t<Sndr, Error>{{}, static_cast<Error&&>(_err), static_cast<Sndr&&>(_sndr)};
+}
+
+inline constexpr stopped_as_optional_t stopped_as_optional{};
+inline constexpr stopped_as_error_t stopped_as_error{};
+
+template <>
+inline constexpr const char* trace_name_v<stopped_as_optional_t> = "stopped_as_optional";
+template <>
+inline constexpr const char* trace_name_v<stopped_as_error_t> = "stopped_as_error";
+} // namespace ustdex
+
+#include "epilogue.hpp"
+
+#endif
@@ -0,0 +1,363 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_STRAND
+#define USTDEX_DETAIL_STRAND
+
+#include "config.hpp"
+
+#if !defined(__CUDA_ARCH__)
+
+#  include "completion_signatures.hpp"
+#  include "cpos.hpp"
+#  include "env.hpp"
+#  include "exception.hpp"
+#  include "lazy.hpp"
+#  include "queries.hpp"
+#  include "utility.hpp"
+
+#  include <atomic>
+#  include <exception>
+#  include <system_error>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+template <class Sch>
+class strand;
+
+namespace _strnd
+{
+struct _task
+{
+  using _complete_fn_t = void(_task*, _disposition_t, ::std::exception_ptr) noexcept;
+
+  _task* _next_ = nullptr;
+  _complete_fn_t* _complete_fn_;
+
+  USTDEX_API void _complete(_disposition_t _how, ::std::exception_ptr _eptr = {}) noexcept
+  {
+    (*_complete_fn_)(this, _how, static_cast<::std::exception_ptr&&>(_eptr));
+  }
+};
+
+template <class Error>
+USTDEX_API auto _as_exception_ptr(Error&& _err) noexcept -> ::std::exception_ptr
+{
+  if constexpr (USTDEX_IS_SAME(USTDEX_DECAY(Error), ::std::exception_ptr))
+  {
+    return static_cast<Error&&>(_err);
+  }
+  else if constexpr (USTDEX_IS_SAME(USTDEX_DECAY(Error), ::std::error_code))
+  {
+    return ::std::make_exception_ptr(::std::system_error(_err));
+  }
+  else
+  {
+    return ::std::make_exception_ptr(static_cast<Error&&>(_err));
+  }
+}
+
+template <class Sch, class Rcvr>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT _opstate_t : _task
+{
+  using operation_state_concept = operation_state_t;
+
+  USTDEX_API _opstate_t(strand<Sch>* _strand, Rcvr _rcvr)
+      : _task{nullptr, &_complete_impl}
+      , _strand_{_strand}
+      , _rcvr_{static_cast<Rcvr&&>(_rcvr)}
+  {}
+
+  USTDEX_IMMOVABLE(_opstate_t);
+
+  USTDEX_API static void _complete_impl(_task* _p, _disposition_t _how, ::std::exception_ptr _eptr) noexcept
+  {
+    auto& _rcvr = static_cast<_opstate_t*>(_p)->_rcvr_;
+    if (_how == _value && get_stop_token(get_env(_rcvr)).stop_requested())
+    {
+      _how = _stopped;
+    }
+    switch (_how)
+    {
+      case _value:
+        ustdex::set_value(static_cast<Rcvr&&>(_rcvr));
+        break;
+      case _error:
+        ustdex::set_error(static_cast<Rcvr&&>(_rcvr), static_cast<::std::exception_ptr&&>(_eptr));
+        break;
+      default:
+        ustdex::set_stopped(static_cast<Rcvr&&>(_rcvr));
+        break;
+    }
+  }
+
+  USTDEX_API void start() & noexcept
+  {
+    // Hold on to the strand: this operation may be destroyed by the time the
+    // strand is released.
+    auto* _strand = _strand_;
+    if (_strand->_enqueue(this))
+    {
+      // No other task is in the strand. Run inline, without a thread hop.
+      _complete(_value);
+      _strand->_release();
+    }
+  }
+
+  strand<Sch>* _strand_;
+  Rcvr _rcvr_;
+};
+} // namespace _strnd
+
+//! \brief Serializes the work scheduled through it on top of another
+//! scheduler.
+//!
+//! Tasks scheduled through a strand's scheduler never run concurrently with
+//! each other, and they run in the order in which they were started. When the
+//! strand is idle, starting a task runs it immediately on the calling thread at
+//! the cost of one compare-and-swap to enter and one to leave the strand. Tasks
+//! started while the strand is busy are pushed onto a lock-free intrusive
+//! queue. Whoever leaves the strand with tasks pending hands them off to the
+//! underlying scheduler, which drains the queue.
+//!
+//! A strand must outlive all work scheduled through it.
+template <class Sch>
+class USTDEX_TYPE_VISIBILITY_DEFAULT strand
+{
+  template <class, class>
+  friend struct _strnd::_opstate_t;
+
+  struct _drain_rcvr_t
+  {
+    using receiver_concept = receiver_t;
+    strand* _strand_;
+
+    USTDEX_API void set_value() noexcept
+    {
+      auto* _strand = _strand_;
+      _strand->_inner_op_.destroy();
+      _strand->_drain(_value);
+    }
+
+    template <class Error>
+    USTDEX_API void set_error(Error&& _err) noexcept
+    {
+      auto* _strand = _strand_;
+      auto _eptr    = _strnd::_as_exception_ptr(static_cast<Error&&>(_err));
+      _strand->_inner_op_.destroy();
+      _strand->_drain(_error, _eptr);
+    }
+
+    USTDEX_API void set_stopped() noexcept
+    {
+      auto* _strand = _strand_;
+      _strand->_inner_op_.destroy();
+      _strand->_drain(_stopped);
+    }
+
+    USTDEX_API auto get_env() const noexcept -> env<>
+    {
+      return {};
+    }
+  };
+
+  using _inner_op_t = connect_result_t<schedule_result_t<Sch&>, _drain_rcvr_t>;
+
+public:
+  class _scheduler
+  {
+    struct _schedule_task
+    {
+      using sender_concept = sender_t;
+
+      template <class Rcvr>
+      USTDEX_API auto connect(Rcvr _rcvr) const noexcept -> _strnd::_opstate_t<Sch, Rcvr>
+      {
+        return {_strand_, static_cast<Rcvr&&>(_rcvr)};
+      }
+
+      template <class Self>
+      USTDEX_API static constexpr auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_error_t(::std::exception_ptr), set_stopped_t()>();
+      }
+
+      struct _env
+      {
+        strand* _strand_;
+
+        template <class Tag>
+        USTDEX_API auto query(get_completion_scheduler_t<Tag>) const noexcept -> _scheduler
+        {
+          return _scheduler{_strand_};
+        }
+      };
+
+      USTDEX_API auto get_env() const noexcept -> _env
+      {
+        return _env{_strand_};
+      }
+
+    private:
+      friend _scheduler;
+
+      USTDEX_API explicit _schedule_task(strand* _strand) noexcept
+          : _strand_(_strand)
+      {}
+
+      strand* _strand_;
+    };
+
+    friend strand;
+
+    USTDEX_API explicit _scheduler(strand* _strand) noexcept
+        : _strand_(_strand)
+    {}
+
+    strand* _strand_;
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    [[nodiscard]] USTDEX_API auto schedule() const noexcept -> _schedule_task
+    {
+      return _schedule_task{_strand_};
+    }
+
+    USTDEX_API friend bool operator==(const _scheduler& _a, const _scheduler& _b) noexcept
+    {
+      return _a._strand_ == _b._strand_;
+    }
+
+    USTDEX_API friend bool operator!=(const _scheduler& _a, const _scheduler& _b) noexcept
+    {
+      return _a._strand_ != _b._strand_;
+    }
+  };
+
+  USTDEX_API explicit strand(Sch _sch)
+      : _sch_{static_cast<Sch&&>(_sch)}
+  {}
+
+  USTDEX_IMMOVABLE(strand);
+
+  USTDEX_API auto get_scheduler() noexcept -> _scheduler
+  {
+    return _scheduler{this};
+  }
+
+private:
+  // The head of the queue is one of:
+  //   - nullptr: no task is running and none is pending.
+  //   - &_active_: a task is running and none is pending.
+  //   - anything else: a task is running and the head points to a LIFO list of
+  //     pending tasks, terminated by &_active_.
+  // Returns true if the caller entered the strand and must run the task.
+  USTDEX_API auto _enqueue(_strnd::_task* _tsk) noexcept -> bool
+  {
+    _strnd::_task* _old = _head_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      if (_old == nullptr)
+      {
+        if (_head_.compare_exchange_weak(_old, &_active_, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+          return true;
+        }
+      }
+      else
+      {
+        _tsk->_next_ = _old;
+        if (_head_.compare_exchange_weak(_old, _tsk, std::memory_order_release, std::memory_order_relaxed))
+        {
+          return false;
+        }
+      }
+    }
+  }
+
+  // Leaves the strand after running a task inline. Pending tasks are handed
+  // off to the underlying scheduler.
+  USTDEX_API void _release() noexcept
+  {
+    _strnd::_task* _expected = &_active_;
+    if (_head_.compare_exchange_strong(_expected, nullptr, std::memory_order_release, std::memory_order_relaxed))
+    {
+      return;
+    }
+
+    USTDEX_TRY
+    {
+      ustdex::start(_inner_op_.construct_from(ustdex::connect, ustdex::schedule(_sch_), _drain_rcvr_t{this}));
+    }
+    USTDEX_CATCH(...)
+    {
+      _drain(_error, ::std::current_exception());
+    }
+  }
+
+  // Completes all pending tasks in order and leaves the strand. Tasks are
+  // completed with the given disposition, which is only something other than
+  // `_value` when the underlying scheduler failed to schedule the drain.
+  USTDEX_API void _drain(_disposition_t _how, ::std::exception_ptr _eptr = {}) noexcept
+  {
+    for (;;)
+    {
+      _strnd::_task* _list = _head_.exchange(&_active_, std::memory_order_acq_rel);
+      if (_list == &_active_)
+      {
+        _strnd::_task* _expected = &_active_;
+        if (_head_.compare_exchange_strong(_expected, nullptr, std::memory_order_release, std::memory_order_relaxed))
+        {
+          return;
+        }
+        continue;
+      }
+
+      // Reverse the list to restore the order in which tasks were enqueued.
+      _strnd::_task* _fifo = nullptr;
+      while (_list != &_active_)
+      {
+        _strnd::_task* _next = _list->_next_;
+        _list->_next_        = _fifo;
+        _fifo                = _list;
+        _list                = _next;
+      }
+
+      while (_fifo != nullptr)
+      {
+        _strnd::_task* _next = _fifo->_next_;
+        _fifo->_complete(_how, _eptr);
+        _fifo = _next;
+      }
+    }
+  }
+
+  Sch _sch_;
+  std::atomic<_strnd::_task*> _head_{nullptr};
+  _strnd::_task _active_{};
+  _lazy<_inner_op_t> _inner_op_;
+};
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
@@ -22,23 +22,37 @@
 #if !defined(__CUDA_ARCH__)
 
 #  include "exception.hpp"
+#  include "into_variant.hpp"
 #  include "run_loop.hpp"
 #  include "write_env.hpp"
 
+#  include <atomic>
 #  include <optional>
 #  include <system_error>
 #  include <tuple> // IWYU pragma: keep
 #  include <type_traits>
+#  include <variant> // IWYU pragma: keep
+
+#  if defined(__cpp_lib_atomic_wait)
+#    include <thread>
+#  else
+#    include <condition_variable>
+#    include <mutex>
+#  endif
 
 #  include "prologue.hpp"
 
 namespace ustdex
 {
+struct sync_wait_with_variant_t;
+
 /// \brief Function object type for synchronously waiting for the result of a
 /// sender.
 struct sync_wait_t
 {
 private:
+  friend sync_wait_with_variant_t;
+
   struct _env_t
   {
     run_loop* _loop_;
@@ -59,7 +73,95 @@ private:
     }
   };
 
-  template <class Values>
+  // A one-shot event with the same `run`/`finish` interface as `run_loop`.
+  // sync_wait blocks on it instead of on a `run_loop` when the sender does
+  // not need a scheduler from the receiver's environment, so no work can be
+  // delegated to the waiting thread.
+  struct _signal_t
+  {
+    USTDEX_API void run() noexcept
+    {
+#  if defined(__cpp_lib_atomic_wait)
+      _state_.wait(_pending, ::std::memory_order_acquire);
+      // The signal may only be destroyed once `finish` is done notifying.
+      while (_state_.load(::std::memory_order_acquire) != _done)
+      {
+        ::std::this_thread::yield();
+      }
+#  else
+      ::std::unique_lock _lock{_mutex_};
+      _cv_.wait(_lock, [this] {
+        return _done_;
+      });
+#  endif
+    }
+
+    USTDEX_API void finish() noexcept
+    {
+#  if defined(__cpp_lib_atomic_wait)
+      // `run` does not return before the last store, so the signal is still
+      // alive while it is notified.
+      _state_.store(_notifying, ::std::memory_order_release);
+      _state_.notify_one();
+      _state_.store(_done, ::std::memory_order_release);
+#  else
+      ::std::lock_guard _lock{_mutex_};
+      _done_ = true;
+      _cv_.notify_one();
+#  endif
+    }
+
+  private:
+#  if defined(__cpp_lib_atomic_wait)
+    enum _phase_t : unsigned char
+    {
+      _pending,
+      _notifying,
+      _done
+    };
+    ::std::atomic<_phase_t> _state_{_pending};
+#  else
+    ::std::mutex _mutex_;
+    ::std::condition_variable _cv_;
+    bool _done_ = false;
+#  endif
+  };
+
+  USTDEX_API static auto _env_of(run_loop& _loop) noexcept -> _env_t
+  {
+    return _env_t{&_loop};
+  }
+
+  USTDEX_API static auto _env_of(_signal_t&) noexcept -> env<>
+  {
+    return {};
+  }
+
+  // Senders whose completions are valid without the scheduler queries can
+  // only be waited on; those that need them get a run_loop to delegate to.
+  template <class Sndr>
+  using _waiter_for = _m_if<sender_in<Sndr, env<>>, _signal_t, run_loop>;
+
+  template <class Waiter>
+  using _env_for = decltype(_env_of(declval<Waiter&>()));
+
+  template <class... Ts, class... As>
+  USTDEX_API static void _emplace(std::optional<std::tuple<Ts...>>& _values, As&&... _as)
+  {
+    _values.emplace(static_cast<As&&>(_as)...);
+  }
+
+  // Constructs the alternative for this value completion in place.
+  template <class... Tuples, class... As>
+  USTDEX_API static void _emplace(std::optional<std::variant<Tuples...>>& _values, As&&... _as)
+  {
+    using _variant_t = std::variant<Tuples...>;
+    constexpr std::size_t _index =
+      ustdex::_std_variant_index<_decayed_std_tuple<As...>>(static_cast<_variant_t*>(nullptr));
+    _values.emplace(std::in_place_index<_index>, static_cast<As&&>(_as)...);
+  }
+
+  template <class Values, class Waiter>
   struct _state_t
   {
     struct USTDEX_TYPE_VISIBILITY_DEFAULT _rcvr_t
@@ -72,13 +174,13 @@ private:
       {
         USTDEX_TRY
         {
-          _state_->_values_->emplace(static_cast<As&&>(_as)...);
+          sync_wait_t::_emplace(*_state_->_values_, static_cast<As&&>(_as)...);
         }
         USTDEX_CATCH(...)
         {
           _state_->_eptr_ = ::std::current_exception();
         }
-        _state_->_loop_.finish();
+        _state_->_waiter_.finish();
       }
 
       template <class Error>
@@ -96,23 +198,23 @@ private:
         {
           _state_->_eptr_ = ::std::make_exception_ptr(static_cast<Error&&>(_err));
         }
-        _state_->_loop_.finish();
+        _state_->_waiter_.finish();
       }
 
       USTDEX_API void set_stopped() noexcept
       {
-        _state_->_loop_.finish();
+        _state_->_waiter_.finish();
       }
 
-      _env_t get_env() const noexcept
+      auto get_env() const noexcept -> _env_for<Waiter>
       {
-        return _env_t{&_state_->_loop_};
+        return _env_of(_state_->_waiter_);
       }
     };
 
     std::optional<Values>* _values_;
     ::std::exception_ptr _eptr_;
-    run_loop _loop_;
+    Waiter _waiter_;
   };
 
   template <class Type>
@@ -131,6 +233,29 @@ private:
     int i{}; // so that structured bindings kinda work
   };
 
+  template <class Values, class Waiter, class Sndr>
+  USTDEX_API static auto _wait(Sndr&& _sndr) -> std::optional<Values>
+  {
+    std::optional<Values> _result{};
+    _state_t<Values, Waiter> _state{&_result, {}, {}};
+
+    // Launch the sender with a continuation that will fill in the result
+    using _rcvr   = typename _state_t<Values, Waiter>::_rcvr_t;
+    auto _opstate = ustdex::connect(static_cast<Sndr&&>(_sndr), _rcvr{&_state});
+    ustdex::start(_opstate);
+
+    // Wait for the result to be filled in, and process any work that
+    // may be delegated to this thread.
+    _state._waiter_.run();
+
+    if (_state._eptr_)
+    {
+      ::std::rethrow_exception(_state._eptr_);
+    }
+
+    return _result; // uses NRVO to "return" the result
+  }
+
 public:
   // clang-format off
     //! \brief Synchronously wait for the result of a sender, blocking the
@@ -140,7 +265,10 @@ public:
     //!         `run_loop` instance until the sender completes. Additional work
     //!         can be delegated to the `run_loop` by scheduling work on the
     //!         scheduler returned by calling `get_delegation_scheduler` on the
-    //!         receiver's environment.
+    //!         receiver's environment. If the sender's completions do not
+    //!         depend on that scheduler, or on `get_scheduler`, there is no
+    //!         work to delegate, and `sync_wait` blocks on an atomic flag
+    //!         instead.
     ///
     //! \pre The sender must have a exactly one value completion signature. That
     //!         is, it can only complete successfully in one way, with a single
@@ -160,7 +288,8 @@ public:
   template <class Sndr>
   auto operator()(Sndr&& _sndr) const
   {
-    using _completions = completion_signatures_of_t<Sndr, _env_t>;
+    using _waiter      = _waiter_for<Sndr>;
+    using _completions = completion_signatures_of_t<Sndr, _env_for<_waiter>>;
 
     if constexpr (!_valid_completion_signatures<_completions>)
     {
@@ -169,24 +298,51 @@ public:
     else
     {
       using _values = _value_types<_completions, std::tuple, _identity_t>;
-      std::optional<_values> _result{};
-      _state_t<_values> _state{&_result, {}, {}};
-
-      // Launch the sender with a continuation that will fill in a variant
-      using _rcvr   = typename _state_t<_values>::_rcvr_t;
-      auto _opstate = ustdex::connect(static_cast<Sndr&&>(_sndr), _rcvr{&_state});
-      ustdex::start(_opstate);
+      return _wait<_values, _waiter>(static_cast<Sndr&&>(_sndr));
+    }
+  }
 
-      // Wait for the variant to be filled in, and process any work that
-      // may be delegated to this thread.
-      _state._loop_.run();
+  template <class Sndr, class Env>
+  auto operator()(Sndr&& _sndr, Env&& _env) const
+  {
+    return (*this)(ustdex::write_env(static_cast<Sndr&&>(_sndr), static_cast<Env&&>(_env)));
+  }
+};
 
-      if (_state._eptr_)
-      {
-        ::std::rethrow_exception(_state._eptr_);
-      }
+/// \brief Function object type for synchronously waiting for the result of a
+/// sender that can complete successfully in more than one way.
+struct sync_wait_with_variant_t
+{
+  // clang-format off
+    //! \brief Synchronously wait for the result of a sender, blocking the
+    //!         current thread.
+    ///
+    //! Like `sync_wait`, but the sender may have several value completion
+    //!         signatures. The values are stored directly into the
+    //!         alternative for the completion that was called.
+    ///
+    //! \pre The sender must have at least one value completion signature.
+    ///
+    //! \retval success Returns an engaged `::std::optional` containing a
+    //!         `::std::variant` with one `::std::tuple` of decayed values per
+    //!         value completion signature.
+    //! \retval canceled Returns an empty `::std::optional`.
+    //! \retval error Throws the error, as `sync_wait` does.
+  // clang-format on
+  template <class Sndr>
+  auto operator()(Sndr&& _sndr) const
+  {
+    using _waiter      = sync_wait_t::_waiter_for<Sndr>;
+    using _completions = completion_signatures_of_t<Sndr, sync_wait_t::_env_for<_waiter>>;
 
-      return _result; // uses NRVO to "return" the result
+    if constexpr (!_valid_completion_signatures<_completions>)
+    {
+      return sync_wait_t::_bad_sync_wait<_completions>::_result();
+    }
+    else
+    {
+      using _values = _std_variant_of<_completions>;
+      return sync_wait_t::_wait<_values, _waiter>(static_cast<Sndr&&>(_sndr));
     }
   }
 
@@ -198,6 +354,7 @@ public:
 };
 
 inline constexpr sync_wait_t sync_wait{};
+inline constexpr sync_wait_with_variant_t sync_wait_with_variant{};
 } // namespace ustdex
 
 #  include "epilogue.hpp"
@@ -24,6 +24,7 @@
 #include "exception.hpp"
 #include "meta.hpp"
 #include "rcvr_ref.hpp"
+#include "trace.hpp"
 
 #include "prologue.hpp"
 
@@ -107,6 +108,7 @@ private:
 
     USTDEX_API void start() & noexcept
     {
+      ustdex::_trace_start(_rcvr_);
       ustdex::start(_opstate_);
     }
 
@@ -227,23 +229,29 @@ private:
     }
 
     template <class Rcvr>
-    USTDEX_API auto connect(Rcvr _rcvr) &&                                         //
-      noexcept(_nothrow_constructible<_opstate_t<Rcvr, Sndr, Fn>, Sndr, Rcvr, Fn>) //
-      -> _opstate_t<Rcvr, Sndr, Fn>
+    USTDEX_API auto connect(Rcvr _rcvr) && //
+      noexcept(_nothrow_constructible<_opstate_t<_traced_rcvr_t<UponTag, Rcvr>, Sndr, Fn>,
+                                      Sndr,
+                                      _traced_rcvr_t<UponTag, Rcvr>,
+                                      Fn>) //
+      -> _opstate_t<_traced_rcvr_t<UponTag, Rcvr>, Sndr, Fn>
     {
-      return _opstate_t<Rcvr, Sndr, Fn>{
-        static_cast<Sndr&&>(_sndr_), static_cast<Rcvr&&>(_rcvr), static_cast<Fn&&>(_fn_)};
+      return _opstate_t<_traced_rcvr_t<UponTag, Rcvr>, Sndr, Fn>{
+        static_cast<Sndr&&>(_sndr_),
+        ustdex::_trace_rcvr<UponTag>(static_cast<Rcvr&&>(_rcvr)),
+        static_cast<Fn&&>(_fn_)};
     }
 
     template <class Rcvr>
     USTDEX_API auto connect(Rcvr _rcvr) const& //
-      noexcept(_nothrow_constructible<_opstate_t<Rcvr, const Sndr&, Fn>,
+      noexcept(_nothrow_constructible<_opstate_t<_traced_rcvr_t<UponTag, Rcvr>, const Sndr&, Fn>,
                                       const Sndr&,
-                                      Rcvr,
+                                      _traced_rcvr_t<UponTag, Rcvr>,
                                       const Fn&>) //
-      -> _opstate_t<Rcvr, const Sndr&, Fn>
+      -> _opstate_t<_traced_rcvr_t<UponTag, Rcvr>, const Sndr&, Fn>
     {
-      return _opstate_t<Rcvr, const Sndr&, Fn>{_sndr_, static_cast<Rcvr&&>(_rcvr), _fn_};
+      return _opstate_t<_traced_rcvr_t<UponTag, Rcvr>, const Sndr&, Fn>{
+        _sndr_, ustdex::_trace_rcvr<UponTag>(static_cast<Rcvr&&>(_rcvr)), _fn_};
     }
 
     USTDEX_API env_of_t<Sndr> get_env() const noexcept
@@ -305,6 +313,13 @@ inline constexpr struct upon_error_t : _upon_t<_error>
 inline constexpr struct upon_stopped_t : _upon_t<_stopped>
 {
 } upon_stopped{};
+
+template <>
+inline constexpr const char* trace_name_v<then_t> = "then";
+template <>
+inline constexpr const char* trace_name_v<upon_error_t> = "upon_error";
+template <>
+inline constexpr const char* trace_name_v<upon_stopped_t> = "upon_stopped";
 } // namespace ustdex
 
 #include "epilogue.hpp"
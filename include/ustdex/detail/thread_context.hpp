@@ -22,20 +22,197 @@
 
 #if !defined(__CUDA_ARCH__)
 
+#  include "exception.hpp"
+#  include "numa.hpp"
 #  include "run_loop.hpp"
 
+#  include <memory>
+#  include <optional>
+#  include <string>
+#  include <system_error>
 #  include <thread>
+#  include <vector>
+
+#  if USTDEX_PTHREADS()
+#    include <pthread.h>
+#    include <sched.h>
+#    if defined(__linux__)
+#      include <sys/resource.h>
+#      include <sys/syscall.h>
+#      include <unistd.h>
+#    endif
+#  endif
 
 #  include "prologue.hpp"
 
 namespace ustdex
 {
+//! \brief Settings for the thread that drives a `thread_context`.
+//!
+//! Every setting is optional. Scheduling, niceness, affinity and name are
+//! applied on a best-effort basis: a request the OS rejects (for instance a
+//! real-time policy without the required privileges) leaves the corresponding
+//! attribute inherited from the creating thread. Only a stack size that cannot
+//! be honored makes thread creation fail. Settings other than the stack size
+//! are ignored on platforms without pthreads.
+struct thread_options
+{
+  //! The CPUs the thread may run on. Empty means inherit. (Linux only)
+  std::vector<int> cpus{};
+  //! A scheduling policy such as `SCHED_FIFO`, or empty to inherit.
+  std::optional<int> sched_policy{};
+  //! The static priority for `sched_policy`.
+  int sched_priority = 0;
+  //! The nice value of the thread, or empty to inherit. (Linux only)
+  std::optional<int> nice{};
+  //! The stack size in bytes, or 0 for the platform default.
+  std::size_t stack_size = 0;
+  //! The name shown by `top`, `perf` and debuggers. Linux truncates names to
+  //! 15 characters.
+  std::string name{};
+};
+
+namespace _thrd
+{
+#  if USTDEX_PTHREADS()
+USTDEX_API inline void _apply_thread_options(const thread_options& _opts) noexcept
+{
+  if (!_opts.name.empty())
+  {
+#    if defined(__APPLE__)
+    ::pthread_setname_np(_opts.name.c_str());
+#    elif defined(__linux__)
+    ::pthread_setname_np(::pthread_self(), _opts.name.substr(0, 15).c_str());
+#    endif
+  }
+
+  if (!_opts.cpus.empty())
+  {
+    _numa::_set_this_thread_affinity(_opts.cpus);
+  }
+
+  if (_opts.sched_policy)
+  {
+    ::sched_param _param{};
+    _param.sched_priority = _opts.sched_priority;
+    ::pthread_setschedparam(::pthread_self(), *_opts.sched_policy, &_param);
+  }
+
+#    if defined(__linux__)
+  // On Linux, the nice value is a per-thread attribute.
+  if (_opts.nice)
+  {
+    ::setpriority(PRIO_PROCESS, static_cast<::id_t>(::syscall(SYS_gettid)), *_opts.nice);
+  }
+#    endif
+}
+
+// A joinable thread created with the requested options.
+class _os_thread
+{
+  template <class Fn>
+  struct _start_t
+  {
+    thread_options _opts_;
+    Fn _fn_;
+  };
+
+  template <class Fn>
+  static void* _trampoline(void* _arg) noexcept
+  {
+    std::unique_ptr<_start_t<Fn>> _start{static_cast<_start_t<Fn>*>(_arg)};
+    _thrd::_apply_thread_options(_start->_opts_);
+    static_cast<Fn&&>(_start->_fn_)();
+    return nullptr;
+  }
+
+public:
+  _os_thread() = default;
+
+  template <class Fn>
+  explicit _os_thread(thread_options _opts, Fn _fn)
+  {
+    ::pthread_attr_t _attr;
+    if (int _err = ::pthread_attr_init(&_attr))
+    {
+      USTDEX_THROW(std::system_error(_err, std::system_category(), "pthread_attr_init"));
+    }
+    std::unique_ptr<::pthread_attr_t, int (*)(::pthread_attr_t*)> _guard{&_attr, &::pthread_attr_destroy};
+
+    if (_opts.stack_size != 0)
+    {
+      if (int _err = ::pthread_attr_setstacksize(&_attr, _opts.stack_size))
+      {
+        USTDEX_THROW(std::system_error(_err, std::system_category(), "pthread_attr_setstacksize"));
+      }
+    }
+
+    auto _start =
+      std::make_unique<_start_t<Fn>>(_start_t<Fn>{static_cast<thread_options&&>(_opts), static_cast<Fn&&>(_fn)});
+    if (int _err = ::pthread_create(&_handle_, &_attr, &_trampoline<Fn>, _start.get()))
+    {
+      USTDEX_THROW(std::system_error(_err, std::system_category(), "pthread_create"));
+    }
+    _start.release();
+    _joinable_ = true;
+  }
+
+  _os_thread(_os_thread&& _other) noexcept
+      : _handle_{_other._handle_}
+      , _joinable_{ustdex::_exchange(_other._joinable_, false)}
+  {}
+
+  ~_os_thread()
+  {
+    if (_joinable_)
+    {
+      std::terminate();
+    }
+  }
+
+  auto joinable() const noexcept -> bool
+  {
+    return _joinable_;
+  }
+
+  void join()
+  {
+    if (int _err = ::pthread_join(_handle_, nullptr))
+    {
+      USTDEX_THROW(std::system_error(_err, std::system_category(), "pthread_join"));
+    }
+    _joinable_ = false;
+  }
+
+private:
+  ::pthread_t _handle_{};
+  bool _joinable_ = false;
+};
+#  else
+// Without pthreads, only the default thread attributes are available.
+class _os_thread : public std::thread
+{
+public:
+  _os_thread() = default;
+
+  template <class Fn>
+  explicit _os_thread(const thread_options&, Fn _fn)
+      : std::thread{static_cast<Fn&&>(_fn)}
+  {}
+};
+#  endif
+} // namespace _thrd
+
 struct USTDEX_TYPE_VISIBILITY_DEFAULT thread_context
 {
   thread_context() noexcept
-      : _thrd_{[this] {
-        _loop_.run();
-      }}
+      : thread_context(thread_options{})
+  {}
+
+  explicit thread_context(thread_options _opts)
+      : _thrd_{static_cast<thread_options&&>(_opts), [this] {
+                 _loop_.run();
+               }}
   {}
 
   ~thread_context() noexcept
@@ -57,9 +234,19 @@ struct USTDEX_TYPE_VISIBILITY_DEFAULT thread_context
     return _loop_.get_scheduler();
   }
 
+#  if USTDEX_RUN_LOOP_METRICS()
+  //! \brief Returns the queue depth and task timings of the context's
+  //! `run_loop`. Only available when built with
+  //! `USTDEX_ENABLE_RUN_LOOP_METRICS`.
+  auto metrics() const noexcept -> run_loop_metrics
+  {
+    return _loop_.metrics();
+  }
+#  endif
+
 private:
   run_loop _loop_;
-  ::std::thread _thrd_;
+  _thrd::_os_thread _thrd_;
 };
 } // namespace ustdex
 
@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_TRACE
+#define USTDEX_DETAIL_TRACE
+
+#include "cpos.hpp"
+#include "meta.hpp"
+#include "queries.hpp"
+#include "type_traits.hpp"
+
+#include <chrono>
+
+#include "prologue.hpp"
+
+namespace ustdex
+{
+//! \brief The events that adaptors and schedulers report to a tracer.
+enum class trace_event : unsigned char
+{
+  start,   //!< The operation has started. For `schedule`, the task is queued.
+  value,   //!< The operation is about to complete with a value. For
+           //!< `schedule`, the task has been dequeued and is about to run.
+  error,   //!< The operation is about to complete with an error.
+  stopped, //!< The operation is about to complete with `set_stopped`.
+  returned //!< The work a scheduler ran for a `schedule` operation returned.
+};
+
+//! \brief The name of an adaptor or CPO tag as reported in traces.
+template <class Tag>
+inline constexpr const char* trace_name_v = "sender";
+
+template <>
+inline constexpr const char* trace_name_v<schedule_t> = "schedule";
+
+template <class Env>
+inline constexpr bool _has_tracer = _callable<get_tracer_t, const Env&>;
+
+// Wraps the receiver of a traced adaptor, and reports the adaptor's
+// completion to the tracer before forwarding it.
+template <class Tag, class Rcvr>
+struct USTDEX_TYPE_VISIBILITY_DEFAULT _traced_rcvr
+{
+  using receiver_concept = receiver_t;
+
+  USTDEX_API void _trace(trace_event _event) const noexcept
+  {
+    ustdex::get_tracer(ustdex::get_env(_rcvr_))(Tag(), _event, this, std::chrono::steady_clock::now());
+  }
+
+  template <class... As>
+  USTDEX_API void set_value(As&&... _as) && noexcept
+  {
+    _trace(trace_event::value);
+    ustdex::set_value(static_cast<Rcvr&&>(_rcvr_), static_cast<As&&>(_as)...);
+  }
+
+  template <class Error>
+  USTDEX_API void set_error(Error&& _error) && noexcept
+  {
+    _trace(trace_event::error);
+    ustdex::set_error(static_cast<Rcvr&&>(_rcvr_), static_cast<Error&&>(_error));
+  }
+
+  USTDEX_API void set_stopped() && noexcept
+  {
+    _trace(trace_event::stopped);
+    ustdex::set_stopped(static_cast<Rcvr&&>(_rcvr_));
+  }
+
+  USTDEX_API auto get_env() const noexcept -> env_of_t<Rcvr>
+  {
+    return ustdex::get_env(_rcvr_);
+  }
+
+  Rcvr _rcvr_;
+};
+
+//! \brief The receiver type that an adaptor tagged `Tag` stores: a
+//! `_traced_rcvr` if the receiver's environment has a tracer, and `Rcvr`
+//! itself otherwise.
+template <class Tag, class Rcvr>
+using _traced_rcvr_t = _m_if<_has_tracer<env_of_t<Rcvr>>, _traced_rcvr<Tag, Rcvr>, Rcvr>;
+
+template <class Tag, class Rcvr>
+USTDEX_TRIVIAL_API auto _trace_rcvr(Rcvr _rcvr) noexcept(_nothrow_decay_copyable<Rcvr>) -> _traced_rcvr_t<Tag, Rcvr>
+{
+  if constexpr (_has_tracer<env_of_t<Rcvr>>)
+  {
+    return _traced_rcvr<Tag, Rcvr>{static_cast<Rcvr&&>(_rcvr)};
+  }
+  else
+  {
+    return _rcvr;
+  }
+}
+
+//! \brief Reports the start of an operation whose receiver is traced. Does
+//! nothing for other receivers.
+template <class Tag, class Rcvr>
+USTDEX_TRIVIAL_API void _trace_start(const _traced_rcvr<Tag, Rcvr>& _rcvr) noexcept
+{
+  _rcvr._trace(trace_event::start);
+}
+
+USTDEX_TRIVIAL_API constexpr void _trace_start(_ignore) noexcept {}
+} // namespace ustdex
+
+#include "epilogue.hpp"
+
+#endif
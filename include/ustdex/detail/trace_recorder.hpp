@@ -0,0 +1,303 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef USTDEX_DETAIL_TRACE_RECORDER
+#define USTDEX_DETAIL_TRACE_RECORDER
+
+#include "config.hpp"
+
+// Threads, strings and mutexes are only needed on the host.
+#if !defined(__CUDA_ARCH__)
+
+#  include "cpos.hpp"
+#  include "exception.hpp"
+#  include "trace.hpp"
+#  include "utility.hpp"
+
+#  include <atomic>
+#  include <chrono>
+#  include <cinttypes>
+#  include <cstddef>
+#  include <cstdint>
+#  include <cstdio>
+#  include <memory>
+#  include <mutex>
+#  include <string>
+#  include <thread>
+#  include <vector>
+
+#  include "prologue.hpp"
+
+namespace ustdex
+{
+//! \brief Records the events that adaptors and schedulers report through
+//! `get_tracer`, and exports them as Chrome Trace Event JSON, which Perfetto
+//! (https://ui.perfetto.dev) and chrome://tracing can open.
+//!
+//! Attach the recorder to a pipeline with
+//! `write_env(sndr, prop{get_tracer, recorder.tracer()})`. In the exported
+//! trace, each adaptor operation is an async slice from its start to its
+//! completion. Each task that a `run_loop` or `thread_context` runs is a slice
+//! on the thread that ran it, with a flow arrow from the point where the task
+//! was queued. The gap between the two is the time the task waited.
+//!
+//! Every thread records into its own ring buffer, which is created the first
+//! time the thread reports an event. After that, recording takes no lock.
+//! When a buffer is full, its oldest events are overwritten. `to_json` must
+//! not run concurrently with recording.
+class trace_recorder
+{
+  struct _event
+  {
+    const char* _name_;
+    const void* _id_;
+    std::chrono::steady_clock::time_point _time_;
+    trace_event _kind_;
+    bool _task_;
+  };
+
+  // A ring buffer with a single writer: the thread it belongs to.
+  struct _buffer
+  {
+    USTDEX_API _buffer(std::size_t _capacity, std::size_t _tid)
+        : _events_(new _event[_capacity])
+        , _capacity_(_capacity)
+        , _tid_(_tid)
+    {}
+
+    USTDEX_API void _push(const _event& _evt) noexcept
+    {
+      const std::size_t _count      = _count_.load(std::memory_order_relaxed);
+      _events_[_count % _capacity_] = _evt;
+      _count_.store(_count + 1, std::memory_order_release);
+    }
+
+    std::unique_ptr<_event[]> _events_;
+    std::size_t _capacity_;
+    std::size_t _tid_;
+    std::thread::id _thread_ = std::this_thread::get_id();
+    std::atomic<std::size_t> _count_{0};
+  };
+
+  struct _tracer_t
+  {
+    template <class Tag>
+    USTDEX_API void
+    operator()(Tag, trace_event _kind, const void* _id, std::chrono::steady_clock::time_point _time) const noexcept
+    {
+      _recorder_->_record({trace_name_v<Tag>, _id, _time, _kind, USTDEX_IS_SAME(Tag, schedule_t)});
+    }
+
+    trace_recorder* _recorder_;
+  };
+
+public:
+  //! \param events_per_thread The capacity of each thread's ring buffer.
+  USTDEX_API explicit trace_recorder(std::size_t events_per_thread = 1 << 16)
+      : _capacity_(events_per_thread == 0 ? 1 : events_per_thread)
+  {}
+
+  USTDEX_IMMOVABLE(trace_recorder);
+
+  //! \brief Returns the tracer to answer `get_tracer` with.
+  USTDEX_API auto tracer() noexcept -> _tracer_t
+  {
+    return _tracer_t{this};
+  }
+
+  //! \brief Returns the number of events recorded so far, including those
+  //! that have been overwritten.
+  USTDEX_API auto recorded() const noexcept -> std::size_t
+  {
+    std::lock_guard _lock{_mutex_};
+    std::size_t _total = 0;
+    for (auto& _buf : _buffers_)
+    {
+      _total += _buf->_count_.load(std::memory_order_acquire);
+    }
+    return _total;
+  }
+
+  //! \brief Formats the recorded events as Chrome Trace Event JSON.
+  USTDEX_API auto to_json() const -> std::string
+  {
+    std::lock_guard _lock{_mutex_};
+    std::string _out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    _out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"ustdex\"}}";
+    for (auto& _buf : _buffers_)
+    {
+      char _line[128];
+      std::snprintf(_line,
+                    sizeof(_line),
+                    ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"thread %zu\"}}",
+                    _buf->_tid_,
+                    _buf->_tid_);
+      _out += _line;
+
+      const std::size_t _count = _buf->_count_.load(std::memory_order_acquire);
+      const std::size_t _first = _count > _buf->_capacity_ ? _count - _buf->_capacity_ : 0;
+      for (std::size_t _i = _first; _i != _count; ++_i)
+      {
+        _append_event(_out, _buf->_events_[_i % _buf->_capacity_], _buf->_tid_);
+      }
+    }
+    _out += "\n]}\n";
+    return _out;
+  }
+
+private:
+  // Identifies a recorder in the thread-local cache, whose entry must not
+  // match a new recorder that reuses the address of a destroyed one.
+  USTDEX_API static auto _next_id() noexcept -> std::uint64_t
+  {
+    static std::atomic<std::uint64_t> _id{0};
+    return _id.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  USTDEX_API auto _local_buffer() -> _buffer&
+  {
+    struct _cache_t
+    {
+      std::uint64_t _recorder_id_ = 0;
+      _buffer* _buffer_           = nullptr;
+    };
+    thread_local _cache_t _cache;
+
+    if (_cache._recorder_id_ != _id_)
+    {
+      std::lock_guard _lock{_mutex_};
+      _buffer* _buf = nullptr;
+      for (auto& _other : _buffers_)
+      {
+        if (_other->_thread_ == std::this_thread::get_id())
+        {
+          _buf = _other.get();
+          break;
+        }
+      }
+      if (_buf == nullptr)
+      {
+        _buffers_.push_back(std::make_unique<_buffer>(_capacity_, _buffers_.size() + 1));
+        _buf = _buffers_.back().get();
+      }
+      _cache = {_id_, _buf};
+    }
+    return *_cache._buffer_;
+  }
+
+  USTDEX_API void _record(const _event& _evt) noexcept
+  {
+    USTDEX_TRY
+    {
+      _local_buffer()._push(_evt);
+    }
+    USTDEX_CATCH(...)
+    {
+      // The thread's buffer could not be allocated; drop the event.
+    }
+  }
+
+  USTDEX_API void _append_event(std::string& _out, const _event& _evt, std::size_t _tid) const
+  {
+    static constexpr const char* _completions[] = {"start", "value", "error", "stopped", "returned"};
+    const double _ts        = std::chrono::duration<double, std::micro>(_evt._time_ - _epoch_).count();
+    const auto _id          = reinterpret_cast<std::uintptr_t>(_evt._id_);
+    const char* _completion = _completions[static_cast<std::size_t>(_evt._kind_)];
+    char _line[256];
+
+    if (!_evt._task_)
+    {
+      // An adaptor operation is an async slice, as it may start and complete
+      // on different threads.
+      if (_evt._kind_ == trace_event::start)
+      {
+        std::snprintf(_line,
+                      sizeof(_line),
+                      ",\n{\"name\":\"%s\",\"cat\":\"ustdex\",\"ph\":\"b\",\"id\":\"0x%" PRIxPTR
+                      "\",\"ts\":%.3f,\"pid\":1,\"tid\":%zu}",
+                      _evt._name_,
+                      _id,
+                      _ts,
+                      _tid);
+      }
+      else
+      {
+        std::snprintf(_line,
+                      sizeof(_line),
+                      ",\n{\"name\":\"%s\",\"cat\":\"ustdex\",\"ph\":\"e\",\"id\":\"0x%" PRIxPTR
+                      "\",\"ts\":%.3f,\"pid\":1,\"tid\":%zu,\"args\":{\"completion\":\"%s\"}}",
+                      _evt._name_,
+                      _id,
+                      _ts,
+                      _tid,
+                      _completion);
+      }
+      _out += _line;
+    }
+    else if (_evt._kind_ == trace_event::start)
+    {
+      // The task was queued: mark it and start a flow to where it runs.
+      std::snprintf(_line,
+                    sizeof(_line),
+                    ",\n{\"name\":\"queued\",\"cat\":\"ustdex\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%zu}"
+                    ",\n{\"name\":\"hop\",\"cat\":\"ustdex\",\"ph\":\"s\",\"id\":\"0x%" PRIxPTR
+                    "\",\"ts\":%.3f,\"pid\":1,\"tid\":%zu}",
+                    _ts,
+                    _tid,
+                    _id,
+                    _ts,
+                    _tid);
+      _out += _line;
+    }
+    else if (_evt._kind_ == trace_event::returned)
+    {
+      std::snprintf(_line, sizeof(_line), ",\n{\"ph\":\"E\",\"ts\":%.3f,\"pid\":1,\"tid\":%zu}", _ts, _tid);
+      _out += _line;
+    }
+    else
+    {
+      // The task was dequeued and is about to run: begin its slice and end
+      // the flow inside it.
+      std::snprintf(_line,
+                    sizeof(_line),
+                    ",\n{\"name\":\"task\",\"cat\":\"ustdex\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":1,\"tid\":%zu,"
+                    "\"args\":{\"completion\":\"%s\"}}"
+                    ",\n{\"name\":\"hop\",\"cat\":\"ustdex\",\"ph\":\"f\",\"bp\":\"e\",\"id\":\"0x%" PRIxPTR
+                    "\",\"ts\":%.3f,\"pid\":1,\"tid\":%zu}",
+                    _ts,
+                    _tid,
+                    _completion,
+                    _id,
+                    _ts,
+                    _tid);
+      _out += _line;
+    }
+  }
+
+  std::size_t _capacity_;
+  std::uint64_t _id_ = _next_id();
+  std::chrono::steady_clock::time_point _epoch_ = std::chrono::steady_clock::now();
+  mutable std::mutex _mutex_;
+  std::vector<std::unique_ptr<_buffer>> _buffers_;
+};
+} // namespace ustdex
+
+#  include "epilogue.hpp"
+
+#endif // !defined(__CUDA_ARCH__)
+
+#endif
@@ -36,6 +36,12 @@ namespace ustdex
 /* the need for a default constructor for each alternative type.                */
 /********************************************************************************/
 
+// The smallest unsigned integral type that can hold the index of any of
+// `Count` alternatives plus one extra value for the valueless state.
+template <std::size_t Count>
+using _variant_index_t =
+  _m_if<(Count < 0xFFu), unsigned char, _m_if<(Count < 0xFFFFu), unsigned short, std::size_t>>;
+
 template <class Idx, class... Ts>
 class _variant_impl;
 
@@ -48,36 +54,69 @@ public:
   {}
 };
 
+// Holds the storage and the index of a variant, and knows how to destroy the
+// active alternative. It never destroys it on its own; see `_variant_dtor`.
+template <class Idx, class... Ts>
+class _variant_base;
+
 template <std::size_t... Idx, class... Ts>
-class _variant_impl<std::index_sequence<Idx...>, Ts...>
+class _variant_base<std::index_sequence<Idx...>, Ts...>
 {
   static constexpr std::size_t _max_size = _maximum({sizeof(Ts)...});
   static_assert(_max_size != 0);
-  std::size_t _index_{_npos};
-  alignas(Ts...) unsigned char _storage_[_max_size];
+
+protected:
+  using _index_t                       = _variant_index_t<sizeof...(Ts)>;
+  static constexpr _index_t _valueless = static_cast<_index_t>(-1);
 
   template <std::size_t Ny>
   using _at = _m_index<Ny, Ts...>;
 
+  // With many alternatives, a chain of index comparisons is slower than an
+  // indirect call through a table indexed by the alternative.
+#if defined(__CUDA_ARCH__)
+  static constexpr bool _use_jump_table = false;
+#else
+  static constexpr bool _use_jump_table = sizeof...(Ts) >= 8;
+#endif
+
+  template <std::size_t Ny>
+  USTDEX_API static void _destroy_at(void* _ptr) noexcept
+  {
+    std::destroy_at(static_cast<_at<Ny>*>(_ptr));
+  }
+
   USTDEX_API void _destroy() noexcept
   {
-    if (_index_ != _npos)
+    if constexpr ((std::is_trivially_destructible_v<Ts> && ...))
+    {
+      _index_ = _valueless;
+    }
+    else if (_index_ != _valueless)
     {
       // make this local in case destroying the sub-object destroys *this
-      const auto index = ustdex::_exchange(_index_, _npos);
-      ((Idx == index ? std::destroy_at(static_cast<_at<Idx>*>(_ptr())) : void(0)), ...);
+      const std::size_t index = ustdex::_exchange(_index_, _valueless);
+      if constexpr (_use_jump_table)
+      {
+        static constexpr void (*_table[])(void*) noexcept = {&_destroy_at<Idx>...};
+        _table[index](_ptr());
+      }
+      else
+      {
+        ((Idx == index ? std::destroy_at(static_cast<_at<Idx>*>(_ptr())) : void(0)), ...);
+      }
     }
   }
 
-public:
-  USTDEX_IMMOVABLE(_variant_impl);
+  // The index follows the storage so that it can live in what would otherwise
+  // be tail padding of the largest alternative.
+  alignas(Ts...) unsigned char _storage_[_max_size];
+  _index_t _index_{_valueless};
 
-  USTDEX_API _variant_impl() noexcept {}
+public:
+  USTDEX_IMMOVABLE(_variant_base);
 
-  USTDEX_API ~_variant_impl()
-  {
-    _destroy();
-  }
+  USTDEX_API _variant_base() noexcept {}
 
   USTDEX_TRIVIAL_API void* _ptr() noexcept
   {
@@ -86,8 +125,54 @@ public:
 
   USTDEX_TRIVIAL_API std::size_t _index() const noexcept
   {
-    return _index_;
+    return _index_ == _valueless ? _npos : _index_;
+  }
+};
+
+// Destroys the active alternative, unless all alternatives are trivially
+// destructible, in which case the variant is trivially destructible as well.
+template <bool TriviallyDestructible, class Base>
+class _variant_dtor : public Base
+{};
+
+template <class Base>
+class _variant_dtor<false, Base> : public Base
+{
+public:
+  USTDEX_API _variant_dtor() noexcept {}
+
+  USTDEX_API ~_variant_dtor()
+  {
+    this->_destroy();
   }
+};
+
+template <std::size_t... Idx, class... Ts>
+class _variant_impl<std::index_sequence<Idx...>, Ts...>
+    : public _variant_dtor<(std::is_trivially_destructible_v<Ts> && ...),
+                           _variant_base<std::index_sequence<Idx...>, Ts...>>
+{
+  using _index_t = _variant_index_t<sizeof...(Ts)>;
+
+  template <std::size_t Ny>
+  using _at = _m_index<Ny, Ts...>;
+
+  using _variant_impl::_variant_base::_destroy;
+  using _variant_impl::_variant_base::_index_;
+  using _variant_impl::_variant_base::_use_jump_table;
+
+  template <std::size_t Ny, class Fn, class Self, class... As>
+  USTDEX_API static void _visit_at(Fn&& _fn, Self&& _self, As&&... _as) //
+    noexcept(_nothrow_callable<Fn, As..., _copy_cvref_t<Self, _at<Ny>>>)
+  {
+    static_cast<Fn&&>(_fn)(static_cast<As&&>(_as)..., static_cast<Self&&>(_self).template _get<Ny>());
+  }
+
+public:
+  USTDEX_API _variant_impl() noexcept {}
+
+  using _variant_impl::_variant_base::_index;
+  using _variant_impl::_variant_base::_ptr;
 
   template <class Ty, class... As>
   USTDEX_API Ty& _emplace(As&&... _as) //
@@ -98,7 +183,7 @@ public:
 
     _destroy();
     Ty* _value = ::new (_ptr()) Ty{static_cast<As&&>(_as)...};
-    _index_    = _new_index;
+    _index_    = static_cast<_index_t>(_new_index);
     return *std::launder(_value);
   }
 
@@ -110,7 +195,7 @@ public:
 
     _destroy();
     _at<Ny>* _value = ::new (_ptr()) _at<Ny>{static_cast<As&&>(_as)...};
-    _index_         = Ny;
+    _index_         = static_cast<_index_t>(Ny);
     return *std::launder(_value);
   }
 
@@ -124,7 +209,7 @@ public:
 
     _destroy();
     _result_t* _value = ::new (_ptr()) _result_t(static_cast<Fn&&>(_fn)(static_cast<As&&>(_as)...));
-    _index_           = _new_index;
+    _index_           = static_cast<_index_t>(_new_index);
     return *std::launder(_value);
   }
 
@@ -133,31 +218,40 @@ public:
     noexcept((_nothrow_callable<Fn, As..., _copy_cvref_t<Self, Ts>> && ...))
   {
     // make this local in case destroying the sub-object destroys *this
-    const auto index = _self._index_;
+    const std::size_t index = _self._index();
     USTDEX_ASSERT(index != _npos, "");
-    ((Idx == index ? static_cast<Fn&&>(_fn)(static_cast<As&&>(_as)..., static_cast<Self&&>(_self).template _get<Idx>())
-                   : void()),
-     ...);
+    if constexpr (_use_jump_table)
+    {
+      static constexpr void (*_table[])(Fn&&, Self&&, As&&...) = {&_visit_at<Idx, Fn, Self, As...>...};
+      _table[index](static_cast<Fn&&>(_fn), static_cast<Self&&>(_self), static_cast<As&&>(_as)...);
+    }
+    else
+    {
+      ((Idx == index
+          ? static_cast<Fn&&>(_fn)(static_cast<As&&>(_as)..., static_cast<Self&&>(_self).template _get<Idx>())
+          : void()),
+       ...);
+    }
   }
 
   template <std::size_t Ny>
   USTDEX_API _at<Ny>&& _get() && noexcept
   {
-    USTDEX_ASSERT(Ny == _index_, "");
+    USTDEX_ASSERT(Ny == _index(), "");
     return static_cast<_at<Ny>&&>(*static_cast<_at<Ny>*>(_ptr()));
   }
 
   template <std::size_t Ny>
   USTDEX_API _at<Ny>& _get() & noexcept
   {
-    USTDEX_ASSERT(Ny == _index_, "");
+    USTDEX_ASSERT(Ny == _index(), "");
     return *static_cast<_at<Ny>*>(_ptr());
   }
 
   template <std::size_t Ny>
   USTDEX_API const _at<Ny>& _get() const& noexcept
   {
-    USTDEX_ASSERT(Ny == _index_, "");
+    USTDEX_ASSERT(Ny == _index(), "");
     return *static_cast<const _at<Ny>*>(_ptr());
   }
 };
@@ -28,6 +28,7 @@
 #include "lazy.hpp"
 #include "meta.hpp"
 #include "stop_token.hpp"
+#include "trace.hpp"
 #include "tuple.hpp"
 #include "type_traits.hpp"
 #include "utility.hpp"
@@ -80,7 +81,7 @@ private:
 
     // TODO: only forward the "forwarding" queries
     template <class Tag>
-    USTDEX_API auto query(Tag) const noexcept -> _query_result_t<Tag, env_of_t<_rcvr_t>>
+    USTDEX_API auto query(Tag) const noexcept -> _query_result_t<env_of_t<_rcvr_t>, Tag>
     {
       return ustdex::get_env(_state_._rcvr_).query(Tag());
     }
@@ -320,6 +321,8 @@ private:
     //! Start all the sub-operations.
     USTDEX_API void start() & noexcept
     {
+      ustdex::_trace_start(_state_._rcvr_);
+
       // register stop callback:
       _state_._on_stop_.construct(
         get_stop_token(ustdex::get_env(_state_._rcvr_)), _on_stop_request{_state_._stop_source_});
@@ -401,7 +404,7 @@ USTDEX_API constexpr auto when_all_t::_merge_completions(Completions... _cs)
       using _m_list_size_fn                                    = _m_bind_front<_m_indirect_q<_m_apply>, _m_size>;
       std::array<std::size_t, sizeof...(Completions)> _offsets = {
         _value_types<Completions, _m_list, _m_list_size_fn::call>::value...};
-      (void) ustdex::exclusive_scan(_offsets.begin(), _offsets.end(), _offsets.begin(), 0ul);
+      (void) ustdex::_exclusive_scan(_offsets.begin(), _offsets.end(), _offsets.begin(), 0ul);
 
       // All child senders have exactly one value completion signature, each of
       // which may have multiple arguments. Concatenate all the arguments into a
@@ -445,15 +448,17 @@ struct USTDEX_TYPE_VISIBILITY_DEFAULT when_all_t::_sndr_t
   }
 
   template <class Rcvr>
-  USTDEX_API auto connect(Rcvr _rcvr) && -> _opstate_t<Rcvr, _cp, _sndrs_t>
+  USTDEX_API auto connect(Rcvr _rcvr) && -> _opstate_t<_traced_rcvr_t<when_all_t, Rcvr>, _cp, _sndrs_t>
   {
-    return _opstate_t<Rcvr, _cp, _sndrs_t>(static_cast<_sndrs_t&&>(_sndrs_), static_cast<Rcvr&&>(_rcvr));
+    return _opstate_t<_traced_rcvr_t<when_all_t, Rcvr>, _cp, _sndrs_t>(
+      static_cast<_sndrs_t&&>(_sndrs_), ustdex::_trace_rcvr<when_all_t>(static_cast<Rcvr&&>(_rcvr)));
   }
 
   template <class Rcvr>
-  USTDEX_API auto connect(Rcvr _rcvr) const& -> _opstate_t<Rcvr, _cpclr, _sndrs_t>
+  USTDEX_API auto connect(Rcvr _rcvr) const& -> _opstate_t<_traced_rcvr_t<when_all_t, Rcvr>, _cpclr, _sndrs_t>
   {
-    return _opstate_t<Rcvr, _cpclr, _sndrs_t>(_sndrs_, static_cast<Rcvr&&>(_rcvr));
+    return _opstate_t<_traced_rcvr_t<when_all_t, Rcvr>, _cpclr, _sndrs_t>(
+      _sndrs_, ustdex::_trace_rcvr<when_all_t>(static_cast<Rcvr&&>(_rcvr)));
   }
 };
 
@@ -472,6 +477,9 @@ USTDEX_API auto when_all_t::operator()(Sndrs... _sndrs) const -> _sndr_t<Sndrs..
 
 inline constexpr when_all_t when_all{};
 
+template <>
+inline constexpr const char* trace_name_v<when_all_t> = "when_all";
+
 } // namespace ustdex
 
 #include "epilogue.hpp"
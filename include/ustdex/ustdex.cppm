@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The `ustdex` named module. It exports the same public API as
+// <ustdex/ustdex.hpp>, which it includes in its global module fragment. Build
+// it with -DUSTDEX_BUILD_MODULE=ON and link with the ustdex_module target.
+module;
+
+#include "ustdex.hpp"
+
+export module ustdex;
+
+export namespace ustdex
+{
+// Concepts and traits
+using ustdex::dependent_sender;
+using ustdex::enable_sender;
+using ustdex::receiver;
+using ustdex::receiver_of;
+using ustdex::sender;
+using ustdex::sender_in;
+using ustdex::sends_stopped;
+
+// Concept tags
+using ustdex::operation_state_t;
+using ustdex::receiver_t;
+using ustdex::scheduler_t;
+using ustdex::sender_t;
+
+// Completion signatures
+using ustdex::completion_signatures;
+using ustdex::completion_signatures_of_t;
+using ustdex::concat_completion_signatures;
+using ustdex::dependent_sender_error;
+using ustdex::error_types_of_t;
+using ustdex::get_child_completion_signatures;
+using ustdex::get_completion_signatures;
+using ustdex::invalid_completion_signature;
+using ustdex::make_completion_signatures;
+using ustdex::transform_completion_signatures;
+using ustdex::value_types_of_t;
+
+// Customization points
+using ustdex::connect;
+using ustdex::connect_result_t;
+using ustdex::connect_t;
+using ustdex::schedule;
+using ustdex::schedule_result_t;
+using ustdex::schedule_t;
+using ustdex::set_error;
+using ustdex::set_error_t;
+using ustdex::set_stopped;
+using ustdex::set_stopped_t;
+using ustdex::set_value;
+using ustdex::set_value_t;
+using ustdex::start;
+using ustdex::start_t;
+
+// Environments and queries
+using ustdex::allocate_let_opstate;
+using ustdex::allocate_let_opstate_t;
+using ustdex::default_domain;
+using ustdex::domain_of_t;
+using ustdex::env;
+using ustdex::env_of_t;
+using ustdex::forward_progress_guarantee;
+using ustdex::get_allocator;
+using ustdex::get_allocator_t;
+using ustdex::get_completion_scheduler;
+using ustdex::get_completion_scheduler_t;
+using ustdex::get_delegation_scheduler;
+using ustdex::get_delegation_scheduler_t;
+using ustdex::get_domain;
+using ustdex::get_domain_t;
+using ustdex::get_env;
+using ustdex::get_env_t;
+using ustdex::get_forward_progress_guarantee;
+using ustdex::get_forward_progress_guarantee_t;
+using ustdex::get_numa_node;
+using ustdex::get_numa_node_t;
+using ustdex::get_scheduler;
+using ustdex::get_scheduler_t;
+using ustdex::get_start_scheduler;
+using ustdex::get_start_scheduler_t;
+using ustdex::get_stop_token;
+using ustdex::get_stop_token_t;
+using ustdex::get_tracer;
+using ustdex::get_tracer_t;
+using ustdex::prop;
+using ustdex::stop_token_of_t;
+using ustdex::trace_event;
+
+// Stop tokens
+using ustdex::inplace_stop_callback;
+using ustdex::inplace_stop_source;
+using ustdex::inplace_stop_token;
+using ustdex::never_stop_token;
+using ustdex::stop_callback_for_t;
+
+// Sender factories
+using ustdex::just;
+using ustdex::just_error;
+using ustdex::just_error_from;
+using ustdex::just_error_from_t;
+using ustdex::just_error_t;
+using ustdex::just_from;
+using ustdex::just_from_t;
+using ustdex::just_stopped;
+using ustdex::just_stopped_from;
+using ustdex::just_stopped_from_t;
+using ustdex::just_stopped_t;
+using ustdex::just_t;
+using ustdex::read_env;
+using ustdex::read_env_t;
+
+// Sender adaptors
+using ustdex::conditional;
+using ustdex::continue_on_t;
+using ustdex::continues_on;
+using ustdex::into_variant;
+using ustdex::into_variant_t;
+using ustdex::let_error;
+using ustdex::let_error_t;
+using ustdex::let_stopped;
+using ustdex::let_stopped_t;
+using ustdex::let_value;
+using ustdex::let_value_t;
+using ustdex::sequence;
+using ustdex::sequence_t;
+using ustdex::start_on_t;
+using ustdex::starts_on;
+using ustdex::stopped_as_error;
+using ustdex::stopped_as_error_t;
+using ustdex::stopped_as_optional;
+using ustdex::stopped_as_optional_t;
+using ustdex::then;
+using ustdex::then_t;
+using ustdex::upon_error;
+using ustdex::upon_error_t;
+using ustdex::upon_stopped;
+using ustdex::upon_stopped_t;
+using ustdex::when_all;
+using ustdex::when_all_t;
+using ustdex::write_env;
+using ustdex::write_env_t;
+
+// Sender consumers
+using ustdex::start_detached;
+using ustdex::start_detached_t;
+using ustdex::sync_wait;
+using ustdex::sync_wait_t;
+using ustdex::sync_wait_with_variant;
+using ustdex::sync_wait_with_variant_t;
+
+// Parallel algorithms
+using ustdex::exclusive_scan;
+using ustdex::exclusive_scan_t;
+using ustdex::inclusive_scan;
+using ustdex::inclusive_scan_t;
+using ustdex::reduce;
+using ustdex::reduce_t;
+using ustdex::sort;
+using ustdex::sort_t;
+using ustdex::transform_reduce;
+using ustdex::transform_reduce_t;
+
+// Execution contexts
+using ustdex::numa_node;
+using ustdex::numa_thread_pool;
+using ustdex::numa_topology;
+using ustdex::priority_run_loop;
+using ustdex::run_loop;
+using ustdex::strand;
+using ustdex::thread_context;
+using ustdex::thread_options;
+#if defined(__linux__)
+using ustdex::async_wait_child;
+using ustdex::async_wait_child_t;
+using ustdex::async_wait_signal;
+using ustdex::async_wait_signal_t;
+using ustdex::epoll_context;
+#endif
+
+// Diagnostics
+using ustdex::get_opstate_layout;
+using ustdex::get_opstate_layout_t;
+using ustdex::histogram_snapshot;
+using ustdex::latency_histogram;
+using ustdex::opstate_layout;
+using ustdex::run_loop_metrics;
+#if USTDEX_LOCK_PROFILING()
+using ustdex::get_lock_stats;
+using ustdex::lock_stats;
+using ustdex::lock_stats_report;
+#endif
+using ustdex::trace_name_v;
+using ustdex::trace_recorder;
+} // namespace ustdex
@@ -16,22 +16,37 @@
  */
 #pragma once
 
-#include "detail/conditional.hpp"    // IWYU pragma: export
-#include "detail/config.hpp"         // IWYU pragma: export
-#include "detail/continues_on.hpp"   // IWYU pragma: export
-#include "detail/cpos.hpp"           // IWYU pragma: export
-#include "detail/just.hpp"           // IWYU pragma: export
-#include "detail/just_from.hpp"      // IWYU pragma: export
-#include "detail/let_value.hpp"      // IWYU pragma: export
-#include "detail/queries.hpp"        // IWYU pragma: export
-#include "detail/read_env.hpp"       // IWYU pragma: export
-#include "detail/run_loop.hpp"       // IWYU pragma: export
-#include "detail/sequence.hpp"       // IWYU pragma: export
-#include "detail/start_detached.hpp" // IWYU pragma: export
-#include "detail/starts_on.hpp"      // IWYU pragma: export
-#include "detail/stop_token.hpp"     // IWYU pragma: export
-#include "detail/sync_wait.hpp"      // IWYU pragma: export
-#include "detail/then.hpp"           // IWYU pragma: export
-#include "detail/thread_context.hpp" // IWYU pragma: export
-#include "detail/when_all.hpp"       // IWYU pragma: export
-#include "detail/write_env.hpp"      // IWYU pragma: export
+#include "detail/conditional.hpp"       // IWYU pragma: export
+#include "detail/config.hpp"            // IWYU pragma: export
+#include "detail/continues_on.hpp"      // IWYU pragma: export
+#include "detail/cpos.hpp"              // IWYU pragma: export
+#include "detail/epoll_context.hpp"     // IWYU pragma: export
+#include "detail/into_variant.hpp"      // IWYU pragma: export
+#include "detail/just.hpp"              // IWYU pragma: export
+#include "detail/just_from.hpp"         // IWYU pragma: export
+#include "detail/let_value.hpp"         // IWYU pragma: export
+#include "detail/lock_profile.hpp"      // IWYU pragma: export
+#include "detail/numa.hpp"              // IWYU pragma: export
+#include "detail/numa_thread_pool.hpp"  // IWYU pragma: export
+#include "detail/opstate_layout.hpp"    // IWYU pragma: export
+#include "detail/priority_run_loop.hpp" // IWYU pragma: export
+#include "detail/queries.hpp"           // IWYU pragma: export
+#include "detail/read_env.hpp"          // IWYU pragma: export
+#include "detail/reduce.hpp"            // IWYU pragma: export
+#include "detail/run_loop.hpp"          // IWYU pragma: export
+#include "detail/run_loop_metrics.hpp"  // IWYU pragma: export
+#include "detail/scan.hpp"              // IWYU pragma: export
+#include "detail/sequence.hpp"          // IWYU pragma: export
+#include "detail/sort.hpp"              // IWYU pragma: export
+#include "detail/start_detached.hpp"    // IWYU pragma: export
+#include "detail/starts_on.hpp"         // IWYU pragma: export
+#include "detail/stop_token.hpp"        // IWYU pragma: export
+#include "detail/stopped_as.hpp"        // IWYU pragma: export
+#include "detail/strand.hpp"            // IWYU pragma: export
+#include "detail/sync_wait.hpp"         // IWYU pragma: export
+#include "detail/then.hpp"              // IWYU pragma: export
+#include "detail/thread_context.hpp"    // IWYU pragma: export
+#include "detail/trace.hpp"             // IWYU pragma: export
+#include "detail/trace_recorder.hpp"    // IWYU pragma: export
+#include "detail/when_all.hpp"          // IWYU pragma: export
+#include "detail/write_env.hpp"         // IWYU pragma: export
@@ -0,0 +1,43 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "ustdex/ustdex.hpp"
+
+#include <numeric>
+#include <vector>
+
+namespace
+{
+//! A fake two-node topology with three workers, so that the parallel
+//! algorithms split their range into a number of chunks that is not a power
+//! of two. It works on any machine with at least one CPU.
+inline ustdex::numa_topology two_nodes()
+{
+  auto cpus = ustdex::numa_topology::single_node().nodes[0].cpus;
+  return ustdex::numa_topology{{ustdex::numa_node{3, {cpus[0]}}, ustdex::numa_node{5, {cpus[0], cpus[0]}}}};
+}
+
+//! Returns the values 1, 2, ..., `count`.
+inline std::vector<int> iota(int count)
+{
+  std::vector<int> values(count);
+  std::iota(values.begin(), values.end(), 1);
+  return values;
+}
+} // namespace
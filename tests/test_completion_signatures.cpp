@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+
+#include <exception>
+
+namespace ex = ustdex;
+
+namespace
+{
+struct not_signatures
+{};
+
+template <int I>
+struct value
+{};
+
+template <int I>
+using sigs_t =
+  ex::completion_signatures<ex::set_value_t(value<I>), ex::set_error_t(std::exception_ptr), ex::set_stopped_t()>;
+
+TEST_CASE("concat_completion_signatures removes duplicates", "[completion_signatures]")
+{
+  constexpr auto sigs = ex::concat_completion_signatures(sigs_t<0>(), sigs_t<1>(), sigs_t<2>(), sigs_t<0>());
+  STATIC_REQUIRE(sigs.count(ex::set_value_t()) == 3);
+  STATIC_REQUIRE(sigs.count(ex::set_error_t()) == 1);
+  STATIC_REQUIRE(sigs.count(ex::set_stopped_t()) == 1);
+}
+
+TEST_CASE("concat_completion_signatures of nothing is empty", "[completion_signatures]")
+{
+  STATIC_REQUIRE(USTDEX_IS_SAME(decltype(ex::concat_completion_signatures()), ex::completion_signatures<>));
+}
+
+TEST_CASE("concat_completion_signatures propagates the first invalid argument", "[completion_signatures]")
+{
+  using result_t = decltype(ex::concat_completion_signatures(sigs_t<0>(), not_signatures(), sigs_t<1>(), 42));
+  STATIC_REQUIRE(USTDEX_IS_SAME(result_t, not_signatures));
+}
+
+TEST_CASE("concat_completion_signatures handles many sets", "[completion_signatures]")
+{
+  constexpr auto sigs = ex::concat_completion_signatures(
+    sigs_t<0>(), sigs_t<1>(), sigs_t<2>(), sigs_t<3>(), sigs_t<4>(), sigs_t<5>(), sigs_t<6>(), sigs_t<7>(), sigs_t<8>(),
+    sigs_t<9>(), sigs_t<10>(), sigs_t<11>(), sigs_t<12>(), sigs_t<13>(), sigs_t<14>(), sigs_t<15>(), sigs_t<16>());
+  STATIC_REQUIRE(sigs.count(ex::set_value_t()) == 17);
+  STATIC_REQUIRE(sigs.count(ex::set_error_t()) == 1);
+}
+} // namespace
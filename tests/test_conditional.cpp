@@ -59,4 +59,19 @@ TEST_CASE("simple use of conditional runs exactly one of the two closures", "[ad
   }
 }
 
+TEST_CASE("conditional can be nested", "[adaptors][conditional]")
+{
+  auto is_even = [](int i) {
+    return i % 2 == 0;
+  };
+  auto plus_one = ex::then([](int i) {
+    return i + 1;
+  });
+
+  auto sndr1 = ex::just(42) | ex::conditional(is_even, ex::conditional(is_even, plus_one, plus_one), plus_one);
+
+  auto op = ex::connect(std::move(sndr1), checked_value_receiver{43});
+  ex::start(op);
+}
+
 } // namespace
@@ -55,6 +55,13 @@ TEST_CASE("continues_on simple example", "[adaptors][continues_on]")
   // The receiver checks if we receive the right value
 }
 
+TEST_CASE("continues_on can be connected as a const lvalue", "[adaptors][continues_on]")
+{
+  const auto snd = ex::continues_on(ex::just(13), inline_scheduler{});
+  auto op        = ex::connect(snd, checked_value_receiver{13});
+  ex::start(op);
+}
+
 TEST_CASE("continues_on can be piped", "[adaptors][continues_on]")
 {
   // Just continues_on a value to the impulse scheduler
@@ -234,6 +241,43 @@ TEST_CASE("continues_on keeps sends_stopped from scheduler's sender", "[adaptors
   check_sends_stopped<true>(ex::continues_on(ex::just(3), sched3));
 }
 
+TEST_CASE("continues_on skips the hop when already on the target scheduler", "[adaptors][continues_on]")
+{
+  ex::run_loop loop;
+  auto sch = loop.get_scheduler();
+  std::string order;
+
+  // Without the fast path, the continuation of the first sender would be
+  // enqueued behind the second sender and run after it.
+  ex::start_detached(ex::schedule(sch) | ex::continues_on(sch) | ex::then([&] {
+                       order += 'a';
+                     }));
+  ex::start_detached(ex::schedule(sch) | ex::then([&] {
+                       order += 'b';
+                     }));
+  loop.finish();
+  loop.run();
+  CHECK(order == "ab");
+}
+
+TEST_CASE("continues_on hops when completing on a different scheduler", "[adaptors][continues_on]")
+{
+  ex::run_loop loop1;
+  ex::run_loop loop2;
+  std::string order;
+
+  ex::start_detached(ex::schedule(loop1.get_scheduler()) | ex::continues_on(loop2.get_scheduler())
+                     | ex::then([&] {
+                         order += 'a';
+                       }));
+  loop1.finish();
+  loop1.run();
+  CHECK(order.empty());
+  loop2.finish();
+  loop2.run();
+  CHECK(order == "a");
+}
+
 // struct test_domain_A {
 //   template <ex::sender_expr_for<ex::continue_on_t> Sender, class Env>
 //   auto transform_sender(Sender&&, Env&&) const {
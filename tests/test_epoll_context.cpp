@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ustdex/ustdex.hpp>
+
+#if defined(__linux__)
+
+#  include <atomic>
+#  include <chrono>
+#  include <thread>
+
+#  include <catch2/catch_all.hpp>
+#  include <signal.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+
+namespace ex = ustdex;
+
+namespace
+{
+// Runs an epoll_context on a background thread. Signals waited on by the tests
+// are blocked before the thread is spawned so that it inherits the mask, and
+// the caller's previous mask is restored once the thread has been joined.
+struct epoll_thread
+{
+  explicit epoll_thread(int signo)
+  {
+    ::sigset_t set;
+    ::sigemptyset(&set);
+    ::sigaddset(&set, signo);
+    ::pthread_sigmask(SIG_BLOCK, &set, &old_mask);
+    thread = std::thread{[this] {
+      ctx.run();
+    }};
+  }
+
+  ~epoll_thread()
+  {
+    ctx.finish();
+    thread.join();
+    ::pthread_sigmask(SIG_SETMASK, &old_mask, nullptr);
+  }
+
+  ::sigset_t old_mask;
+  ex::epoll_context ctx;
+  std::thread thread;
+};
+
+TEST_CASE("epoll_context schedules work on its thread", "[context][epoll_context]")
+{
+  epoll_thread loop{SIGUSR1};
+  auto sndr = ex::then(ex::schedule(loop.ctx.get_scheduler()), [] {
+    return std::this_thread::get_id();
+  });
+  auto [id] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(id == loop.thread.get_id());
+}
+
+TEST_CASE("async_wait_signal completes with the signal info", "[context][epoll_context]")
+{
+  epoll_thread loop{SIGUSR1};
+  ::kill(::getpid(), SIGUSR1);
+  auto [info] = ex::sync_wait(ex::async_wait_signal(loop.ctx.get_scheduler(), SIGUSR1)).value();
+  CHECK(info.ssi_signo == SIGUSR1);
+  CHECK(static_cast<::pid_t>(info.ssi_pid) == ::getpid());
+}
+
+TEST_CASE("async_wait_signal can be cancelled", "[context][epoll_context]")
+{
+  epoll_thread loop{SIGUSR2};
+  ex::inplace_stop_source source;
+  source.request_stop();
+  auto sndr = ex::write_env(ex::async_wait_signal(loop.ctx.get_scheduler(), SIGUSR2),
+                            ex::prop{ex::get_stop_token, source.get_token()});
+  CHECK_FALSE(ex::sync_wait(std::move(sndr)).has_value());
+}
+
+TEST_CASE("async_wait_signal is cancelled while waiting", "[context][epoll_context]")
+{
+  epoll_thread loop{SIGUSR2};
+  ex::inplace_stop_source source;
+  auto sndr = ex::write_env(ex::async_wait_signal(loop.ctx.get_scheduler(), SIGUSR2),
+                            ex::prop{ex::get_stop_token, source.get_token()});
+  std::thread stopper{[&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    source.request_stop();
+  }};
+  CHECK_FALSE(ex::sync_wait(std::move(sndr)).has_value());
+  stopper.join();
+}
+
+TEST_CASE("async_wait_signal is cancelled while its signal is pending", "[context][epoll_context]")
+{
+  epoll_thread loop{SIGUSR2};
+  auto sch = loop.ctx.get_scheduler();
+  ::kill(::getpid(), SIGUSR2);
+
+  // Hold the context's thread, so that the wait is registered and stop is
+  // requested in the same batch of tasks, before the pending signal is polled.
+  // The descriptor is then ready while the cancellation is still queued.
+  std::atomic<bool> release{false};
+  ex::start_detached(ex::then(ex::schedule(sch), [&] {
+    while (!release.load())
+    {
+      std::this_thread::yield();
+    }
+  }));
+  std::thread releaser{[&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    release = true;
+  }};
+
+  ex::inplace_stop_source source;
+  auto wait = ex::write_env(ex::async_wait_signal(sch, SIGUSR2), ex::prop{ex::get_stop_token, source.get_token()});
+  auto stop = ex::then(ex::schedule(sch), [&] {
+    source.request_stop();
+  });
+  CHECK_FALSE(ex::sync_wait(ex::when_all(std::move(wait), std::move(stop))).has_value());
+  releaser.join();
+
+  // The cancelled wait left the signal pending. Consume it before the mask is
+  // restored.
+  ::sigset_t set;
+  ::sigemptyset(&set);
+  ::sigaddset(&set, SIGUSR2);
+  ::timespec no_wait{};
+  CHECK(::sigtimedwait(&set, nullptr, &no_wait) == SIGUSR2);
+}
+
+TEST_CASE("async_wait_child reaps the child", "[context][epoll_context]")
+{
+  epoll_thread loop{SIGUSR1};
+  ::pid_t pid = ::fork();
+  REQUIRE(pid >= 0);
+  if (pid == 0)
+  {
+    ::_exit(7);
+  }
+  auto result = ex::sync_wait(ex::async_wait_child(loop.ctx.get_scheduler(), pid));
+  REQUIRE(result.has_value());
+  auto [info] = *result;
+  CHECK(info.si_pid == pid);
+  CHECK(info.si_code == CLD_EXITED);
+  CHECK(info.si_status == 7);
+}
+
+TEST_CASE("async_wait_child reports an error for an unknown pid", "[context][epoll_context]")
+{
+  epoll_thread loop{SIGUSR1};
+  CHECK_THROWS_AS(ex::sync_wait(ex::async_wait_child(loop.ctx.get_scheduler(), -1)), std::system_error);
+}
+} // namespace
+
+#endif // defined(__linux__)
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/checked_receiver.hpp"
+#include "common/stopped_scheduler.hpp"
+#include "common/utility.hpp"
+
+#include <string>
+#include <tuple>
+#include <variant>
+
+namespace ex = ustdex;
+
+namespace
+{
+auto odd_or_even(int i)
+{
+  return ex::just(i)
+       | ex::conditional(
+           [](int i) {
+             return i % 2 == 0;
+           },
+           ex::then([](int i) {
+             return std::string(i, 'x');
+           }),
+           ex::then([](int i) {
+             return i * 2.0;
+           }));
+}
+
+using odd_or_even_t = std::variant<std::tuple<std::string>, std::tuple<double>>;
+
+TEST_CASE("into_variant sends the values of the completion that was called", "[adaptors][into_variant]")
+{
+  auto sndr = ex::into_variant(odd_or_even(4));
+  check_value_types<_m_list<odd_or_even_t>>(sndr);
+  check_error_types<std::exception_ptr>(sndr);
+  check_sends_stopped<false>(sndr);
+
+  auto op = ex::connect(std::move(sndr), checked_value_receiver{odd_or_even_t{std::tuple{std::string("xxxx")}}});
+  ex::start(op);
+
+  auto [result] = ex::sync_wait(odd_or_even(3) | ex::into_variant()).value();
+  CHECK(result == odd_or_even_t{std::tuple{6.0}});
+}
+
+TEST_CASE("into_variant decays the values and passes errors and stopped through", "[adaptors][into_variant]")
+{
+  int i      = 42;
+  auto sndr1 = ex::just() | ex::then([&]() -> int& {
+                 return i;
+               })
+             | ex::into_variant();
+  auto [result] = ex::sync_wait(std::move(sndr1)).value();
+  CHECK(result == std::variant<std::tuple<int>>{std::tuple{42}});
+
+  auto sndr2 = ex::into_variant(ex::just_error(42));
+  check_value_types<>(sndr2);
+  check_error_types<int>(sndr2);
+  auto op2 = ex::connect(std::move(sndr2), checked_error_receiver{42});
+  ex::start(op2);
+
+  auto sndr3 = ex::into_variant(ex::schedule(stopped_scheduler{}));
+  check_value_types<_m_list<std::variant<std::tuple<>>>>(sndr3);
+  check_sends_stopped<true>(sndr3);
+  auto op3 = ex::connect(std::move(sndr3), checked_stopped_receiver{});
+  ex::start(op3);
+}
+
+TEST_CASE("into_variant lets when_all take children with several value completions", "[adaptors][into_variant]")
+{
+  auto sndr       = ex::when_all(odd_or_even(2) | ex::into_variant(), odd_or_even(5) | ex::into_variant());
+  auto [lhs, rhs] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(lhs == odd_or_even_t{std::tuple{std::string("xx")}});
+  CHECK(rhs == odd_or_even_t{std::tuple{10.0}});
+}
+} // namespace
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/checked_receiver.hpp"
+
+#include <array>
+#include <memory>
+#include <type_traits>
+
+namespace ex = ustdex;
+
+namespace
+{
+template <class Ty>
+struct counting_allocator
+{
+  using value_type = Ty;
+
+  counting_allocator(int* count) noexcept
+      : count(count)
+  {}
+
+  template <class Uy>
+  counting_allocator(const counting_allocator<Uy>& other) noexcept
+      : count(other.count)
+  {}
+
+  Ty* allocate(std::size_t n)
+  {
+    ++*count;
+    return std::allocator<Ty>().allocate(n);
+  }
+
+  void deallocate(Ty* ptr, std::size_t n) noexcept
+  {
+    --*count;
+    std::allocator<Ty>().deallocate(ptr, n);
+  }
+
+  friend bool operator==(const counting_allocator& a, const counting_allocator& b) noexcept
+  {
+    return a.count == b.count;
+  }
+
+  friend bool operator!=(const counting_allocator& a, const counting_allocator& b) noexcept
+  {
+    return a.count != b.count;
+  }
+
+  int* count;
+};
+
+// An environment that provides a counting allocator, without saying whether
+// let_value should allocate its second operation state.
+struct allocator_env
+{
+  auto query(ex::get_allocator_t) const noexcept -> counting_allocator<int>
+  {
+    return {count};
+  }
+
+  int* count;
+};
+
+// An environment that opts in or out of allocating the second operation
+// state of let_value.
+template <bool Allocate>
+struct let_env : allocator_env
+{
+  using allocator_env::query;
+
+  auto query(ex::allocate_let_opstate_t) const noexcept -> std::bool_constant<Allocate>
+  {
+    return {};
+  }
+};
+
+template <class Env>
+struct env_receiver
+{
+  using receiver_concept = ex::receiver_t;
+
+  template <class... As>
+  void set_value(As&&...) noexcept
+  {}
+
+  template <class Error>
+  void set_error(Error&&) noexcept
+  {}
+
+  void set_stopped() noexcept {}
+
+  auto get_env() const noexcept -> Env
+  {
+    return env;
+  }
+
+  Env env;
+};
+
+struct just_plus_one
+{
+  auto operator()(int i) const noexcept
+  {
+    return ex::just(i + 1);
+  }
+};
+
+TEST_CASE("let_value calls the function with the predecessor's values", "[adaptors][let_value]")
+{
+  auto sndr = ex::just(41) | ex::let_value(just_plus_one{});
+  auto op   = ex::connect(std::move(sndr), checked_value_receiver{42});
+  ex::start(op);
+}
+
+TEST_CASE("let_value can be nested", "[adaptors][let_value]")
+{
+  auto sndr = ex::just(40) | ex::let_value(just_plus_one{}) | ex::let_value(just_plus_one{});
+  auto op   = ex::connect(std::move(sndr), checked_value_receiver{42});
+  ex::start(op);
+}
+
+TEST_CASE("let_value can allocate the second operation state", "[adaptors][let_value]")
+{
+  int count = 0;
+  auto env  = let_env<true>{{&count}};
+
+  auto sndr = ex::just(41) | ex::let_value([&](int i) {
+                CHECK(count == 0);
+                return ex::just(i) | ex::then([&](int i) {
+                         CHECK(count == 1);
+                         return i + 1;
+                       });
+              });
+  auto [result] = ex::sync_wait(ex::write_env(std::move(sndr), env)).value();
+  CHECK(result == 42);
+  CHECK(count == 0);
+}
+
+TEST_CASE("allocating the second operation state shrinks the parent", "[adaptors][let_value]")
+{
+  // A continuation whose operation state is large, as for an error path that
+  // carries a lot of state but rarely runs.
+  auto sndr = ex::just(41) | ex::let_value([](int) {
+                return ex::just(std::array<char, 4096>{});
+              });
+
+  using alloc_op_t  = ex::connect_result_t<decltype(sndr), env_receiver<let_env<true>>>;
+  using inline_op_t = ex::connect_result_t<decltype(sndr), env_receiver<let_env<false>>>;
+  STATIC_REQUIRE(sizeof(alloc_op_t) < sizeof(inline_op_t));
+  STATIC_REQUIRE(sizeof(inline_op_t) > 4096);
+  STATIC_REQUIRE(sizeof(alloc_op_t) < 256);
+}
+
+TEST_CASE("let_value does not allocate the second operation state by default", "[adaptors][let_value]")
+{
+  int count = 0;
+  auto env  = allocator_env{&count};
+
+  auto sndr     = ex::just(41) | ex::let_value(just_plus_one{});
+  auto [result] = ex::sync_wait(ex::write_env(std::move(sndr), env)).value();
+  CHECK(result == 42);
+  CHECK(count == 0);
+}
+} // namespace
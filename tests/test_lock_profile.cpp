@@ -0,0 +1,131 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+
+#include <thread>
+#include <vector>
+
+namespace ex = ustdex;
+
+#if USTDEX_LOCK_PROFILING()
+namespace
+{
+ex::lock_stats stats_of(const void* owner)
+{
+  for (auto& stats : ex::get_lock_stats())
+  {
+    if (stats.owner == owner)
+    {
+      return stats;
+    }
+  }
+  FAIL("lock not registered");
+  return {};
+}
+
+struct noop
+{
+  void operator()() const noexcept {}
+};
+
+TEST_CASE("run_loop counts its mutex acquisitions", "[lock_profile]")
+{
+  ex::run_loop loop;
+  CHECK(stats_of(&loop).acquisitions == 0);
+
+  int count = 0;
+  for (int i = 0; i < 3; ++i)
+  {
+    ex::start_detached(ex::starts_on(loop.get_scheduler(), ex::just()) | ex::then([&] {
+                         ++count;
+                       }));
+  }
+  loop.finish();
+  loop.run();
+  CHECK(count == 3);
+
+  auto stats = stats_of(&loop);
+  CHECK(std::string(stats.kind) == "run_loop");
+  // One acquisition per task pushed, at least one per task popped.
+  CHECK(stats.acquisitions >= 6);
+  CHECK(stats.contended == 0);
+}
+
+TEST_CASE("inplace_stop_source counts its spin lock acquisitions", "[lock_profile]")
+{
+  ex::inplace_stop_source source;
+  {
+    ex::inplace_stop_callback<noop> cb1(source.get_token(), noop{});
+    ex::inplace_stop_callback<noop> cb2(source.get_token(), noop{});
+  }
+  auto stats = stats_of(&source);
+  CHECK(std::string(stats.kind) == "inplace_stop_source");
+  // Each callback locks once to register and once to deregister.
+  CHECK(stats.acquisitions == 4);
+  CHECK(stats.contended == 0);
+  CHECK(stats.spins == 0);
+}
+
+TEST_CASE("contended acquisitions are counted", "[lock_profile]")
+{
+  ex::inplace_stop_source source;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 10'000; ++j)
+      {
+        ex::inplace_stop_callback<noop> cb(source.get_token(), noop{});
+      }
+    });
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  auto stats = stats_of(&source);
+  CHECK(stats.acquisitions == 80'000);
+  CHECK(stats.contended <= stats.acquisitions);
+  CHECK((stats.contended == 0) == (stats.spins == 0));
+}
+
+TEST_CASE("destroyed locks are folded into a total per kind", "[lock_profile]")
+{
+  auto count = [] {
+    for (auto& stats : ex::get_lock_stats())
+    {
+      if (stats.owner == nullptr && std::string(stats.kind) == "inplace_stop_source")
+      {
+        return stats.instances;
+      }
+    }
+    return std::uint64_t(0);
+  };
+  auto before = count();
+  {
+    ex::inplace_stop_source source;
+  }
+  CHECK(count() == before + 1);
+  CHECK(ex::lock_stats_report().find("inplace_stop_source") != std::string::npos);
+}
+} // namespace
+#endif
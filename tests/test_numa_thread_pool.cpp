@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+#include <ustdex/ustdex.hpp>
+
+namespace ex = ustdex;
+
+namespace
+{
+// A fake two-node topology that works on any machine with at least one CPU.
+ex::numa_topology two_nodes()
+{
+  auto cpus = ex::numa_topology::single_node().nodes[0].cpus;
+  return ex::numa_topology{{ex::numa_node{3, {cpus[0]}}, ex::numa_node{5, {cpus[0], cpus[0]}}}};
+}
+
+TEST_CASE("cpu lists are parsed", "[context][numa]")
+{
+  CHECK(ex::_numa::_parse_cpu_list("0-3,8,10-11\n") == std::vector<int>{0, 1, 2, 3, 8, 10, 11});
+  CHECK(ex::_numa::_parse_cpu_list("5") == std::vector<int>{5});
+  CHECK(ex::_numa::_parse_cpu_list("").empty());
+  CHECK(ex::_numa::_parse_cpu_list("x-y").empty());
+}
+
+TEST_CASE("topology discovery finds at least one node", "[context][numa]")
+{
+  auto topo = ex::numa_topology::discover();
+  REQUIRE_FALSE(topo.nodes.empty());
+  CHECK(topo.cpu_count() > 0);
+}
+
+TEST_CASE("numa_thread_pool starts one worker per cpu", "[context][numa]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  CHECK(pool.node_count() == 2);
+  CHECK(pool.thread_count() == 3);
+}
+
+TEST_CASE("numa_thread_pool schedulers report their node", "[context][numa]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  CHECK(ex::get_numa_node(pool.get_scheduler(0)) == 3);
+  CHECK(ex::get_numa_node(pool.get_scheduler(1)) == 5);
+  CHECK(ex::get_numa_node(pool.get_scheduler()) == ex::numa_any_node);
+  CHECK(ex::get_numa_node(ex::get_env(ex::schedule(pool.get_scheduler(1)))) == 5);
+  CHECK(pool.get_scheduler(1) == pool.get_scheduler(1));
+  CHECK(pool.get_scheduler(0) != pool.get_scheduler(1));
+}
+
+TEST_CASE("numa_thread_pool runs work on its workers", "[context][numa]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  for (std::size_t node = 0; node < pool.node_count(); ++node)
+  {
+    auto sndr = ex::then(ex::schedule(pool.get_scheduler(node)), [] {
+      return std::this_thread::get_id();
+    });
+    auto [id] = ex::sync_wait(std::move(sndr)).value();
+    CHECK(id != std::this_thread::get_id());
+  }
+}
+
+TEST_CASE("numa_thread_pool runs all scheduled work before joining", "[context][numa]")
+{
+  std::atomic<int> count{0};
+  {
+    ex::numa_thread_pool pool{two_nodes()};
+    for (int i = 0; i < 1000; ++i)
+    {
+      ex::start_detached(ex::then(ex::schedule(pool.get_scheduler()), [&] {
+        ++count;
+      }));
+    }
+  }
+  CHECK(count == 1000);
+}
+
+TEST_CASE("numa_thread_pool wakes another node when the target node is busy", "[context][numa]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto node0 = pool.get_scheduler(0);
+  std::atomic<int> ran{0};
+  for (int i = 1; i <= 200; ++i)
+  {
+    // Occupy node 0's only worker and push more work onto its queue. Only a
+    // worker of node 1 can run it.
+    auto sndr = ex::then(ex::schedule(node0), [&] {
+      ex::start_detached(ex::then(ex::schedule(node0), [&] {
+        ++ran;
+      }));
+      auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+      while (ran.load() != i && std::chrono::steady_clock::now() < deadline)
+      {
+        std::this_thread::yield();
+      }
+      return ran.load() == i;
+    });
+    auto [stolen] = ex::sync_wait(std::move(sndr)).value();
+    REQUIRE(stolen);
+  }
+}
+} // namespace
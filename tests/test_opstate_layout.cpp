@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <catch2/catch_all.hpp>
+#include <ustdex/ustdex.hpp>
+
+namespace ex = ustdex;
+
+namespace
+{
+TEST_CASE("opstate layout of a single sender", "[layout]")
+{
+  auto sndr   = ex::just(42);
+  auto layout = ex::get_opstate_layout(sndr);
+  CHECK(layout.connectable);
+  CHECK(layout.children.empty());
+  CHECK(layout.size >= sizeof(int));
+  CHECK(layout.align >= alignof(int));
+}
+
+TEST_CASE("opstate layout follows child senders", "[layout]")
+{
+  auto sndr   = ex::when_all(ex::just(1), ex::just(2.0) | ex::then([](double d) {
+                                         return d;
+                                       }));
+  auto layout = ex::get_opstate_layout(sndr);
+  REQUIRE(layout.children.size() == 2);
+  CHECK(layout.children[0].children.empty());
+  CHECK(layout.children[1].children.size() == 1);
+  CHECK(layout.size >= layout.children[0].size + layout.children[1].size);
+  CHECK(layout.own_size() == layout.size - layout.children[0].size - layout.children[1].size);
+}
+
+TEST_CASE("opstate layout names adaptors after their tags", "[layout]")
+{
+  auto layout = ex::get_opstate_layout(ex::just(1) | ex::then([](int i) {
+                                         return i;
+                                       }));
+  CHECK(layout.name == "then_t");
+  REQUIRE(layout.children.size() == 1);
+  CHECK(layout.children[0].name == "just_t");
+  CHECK(layout.to_string().find("then_t  size=") == 0);
+}
+
+TEST_CASE("opstate layout reports senders that need a richer environment", "[layout]")
+{
+  auto layout = ex::get_opstate_layout(ex::read_env(ex::get_scheduler));
+  CHECK_FALSE(layout.connectable);
+
+  ex::run_loop loop;
+  auto env = ex::prop{ex::get_scheduler, loop.get_scheduler()};
+  CHECK(ex::get_opstate_layout(ex::read_env(ex::get_scheduler), env).connectable);
+}
+} // namespace
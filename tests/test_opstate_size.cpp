@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../tests/common/inline_scheduler.hpp"
+#include "ustdex/detail/continues_on.hpp"
+#include "ustdex/detail/just.hpp"
+#include "ustdex/detail/let_value.hpp"
+#include "ustdex/detail/variant.hpp"
+#include "ustdex/detail/when_all.hpp"
+#include <catch2/catch_all.hpp>
+
+#include <type_traits>
+
+namespace ex = ustdex;
+
+// These tests pin down the sizes of common operation states so that layout
+// regressions show up as test failures. The exact sizes below are for 64-bit
+// targets using the Itanium C++ ABI.
+#if (defined(__x86_64__) || defined(__aarch64__)) && !USTDEX_MSVC()
+#  define USTDEX_CHECK_OPSTATE_SIZES 1
+#else
+#  define USTDEX_CHECK_OPSTATE_SIZES 0
+#endif
+
+namespace
+{
+struct sink_receiver
+{
+  using receiver_concept = ex::receiver_t;
+
+  template <class... As>
+  void set_value(As&&...) noexcept
+  {}
+
+  template <class Error>
+  void set_error(Error&&) noexcept
+  {}
+
+  void set_stopped() noexcept {}
+};
+
+struct just_fn
+{
+  template <class Ty>
+  auto operator()(Ty ty) const noexcept
+  {
+    return ex::just(ty);
+  }
+};
+
+template <class Sndr>
+using opstate_t = ex::connect_result_t<Sndr, sink_receiver>;
+
+TEST_CASE("variant index type is as small as possible", "[variant][layout]")
+{
+  static_assert(USTDEX_IS_SAME(ex::_variant_index_t<1>, unsigned char));
+  static_assert(USTDEX_IS_SAME(ex::_variant_index_t<254>, unsigned char));
+  static_assert(USTDEX_IS_SAME(ex::_variant_index_t<255>, unsigned short));
+  static_assert(USTDEX_IS_SAME(ex::_variant_index_t<65535>, std::size_t));
+}
+
+TEST_CASE("variant index does not add more than alignment padding", "[variant][layout]")
+{
+  static_assert(sizeof(ex::_variant<char, bool>) == 2);
+  static_assert(sizeof(ex::_variant<ex::_tuple<ex::set_value_t>>) == 2);
+  static_assert(sizeof(ex::_variant<int>) == 2 * sizeof(int));
+  static_assert(sizeof(ex::_variant<int, double>) == 2 * sizeof(double));
+  static_assert(sizeof(ex::_variant<char[9], short>) == 10);
+}
+
+TEST_CASE("variant index round-trips through the compact representation", "[variant][layout]")
+{
+  ex::_variant<int, double> var;
+  CHECK(var._index() == ex::_npos);
+  var._emplace<double>(3.14);
+  CHECK(var._index() == 1);
+  var._emplace<int>(42);
+  CHECK(var._index() == 0);
+  CHECK(var._get<0>() == 42);
+}
+
+TEST_CASE("operation states holding only scalars are trivially destructible", "[layout]")
+{
+  using continues_on_t = opstate_t<decltype(ex::continues_on(ex::just(42), inline_scheduler{}))>;
+  using let_value_t    = opstate_t<decltype(ex::let_value(ex::just(42), just_fn{}))>;
+  static_assert(std::is_trivially_destructible_v<continues_on_t>);
+  static_assert(std::is_trivially_destructible_v<let_value_t>);
+}
+
+#if USTDEX_CHECK_OPSTATE_SIZES
+TEST_CASE("continues_on operation state size", "[continues_on][layout]")
+{
+  static_assert(sizeof(opstate_t<decltype(ex::continues_on(ex::just(), inline_scheduler{}))>) <= 40);
+  static_assert(sizeof(opstate_t<decltype(ex::continues_on(ex::just(42), inline_scheduler{}))>) <= 48);
+}
+
+TEST_CASE("let_value operation state size", "[let_value][layout]")
+{
+  static_assert(sizeof(opstate_t<decltype(ex::let_value(ex::just(42), just_fn{}))>) <= 56);
+}
+
+TEST_CASE("when_all operation state size", "[when_all][layout]")
+{
+  static_assert(sizeof(opstate_t<decltype(ex::when_all(ex::just(42), ex::just(1.0)))>) <= 120);
+}
+#endif
+} // namespace
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <thread>
+
+#include <catch2/catch_all.hpp>
+#include <ustdex/ustdex.hpp>
+
+namespace ex = ustdex;
+
+namespace
+{
+template <class Loop>
+void post(Loop& loop, std::size_t priority, std::string& log, char c)
+{
+  ex::start_detached(ex::then(ex::schedule(loop.get_scheduler(priority)), [&log, c] {
+    log += c;
+  }));
+}
+
+TEST_CASE("priority_run_loop serves higher levels first", "[context][priority_run_loop]")
+{
+  ex::priority_run_loop<3> loop;
+  std::string log;
+  post(loop, 0, log, 'a');
+  post(loop, 1, log, 'b');
+  post(loop, 2, log, 'c');
+  post(loop, 0, log, 'd');
+  post(loop, 2, log, 'e');
+  post(loop, 1, log, 'f');
+  loop.finish();
+  loop.run();
+  CHECK(log == "cebfad");
+}
+
+TEST_CASE("priority_run_loop ages starved levels", "[context][priority_run_loop]")
+{
+  ex::priority_run_loop<2> loop{2};
+  std::string log;
+  post(loop, 0, log, 'x');
+  for (int i = 0; i < 5; ++i)
+  {
+    post(loop, 1, log, '1');
+  }
+  loop.finish();
+  loop.run();
+  CHECK(log == "11x111");
+}
+
+TEST_CASE("priority_run_loop schedulers compare by level", "[context][priority_run_loop]")
+{
+  ex::priority_run_loop<2> loop;
+  CHECK(loop.get_scheduler(1) == loop.get_scheduler(1));
+  CHECK(loop.get_scheduler(0) != loop.get_scheduler(1));
+  CHECK(loop.get_scheduler(1).priority() == 1);
+  CHECK(ex::get_completion_scheduler<ex::set_value_t>(ex::get_env(ex::schedule(loop.get_scheduler(1))))
+        == loop.get_scheduler(1));
+}
+
+TEST_CASE("priority_run_loop can be driven by several threads", "[context][priority_run_loop]")
+{
+  ex::priority_run_loop<2> loop;
+  std::thread t1{[&] {
+    loop.run();
+  }};
+  std::thread t2{[&] {
+    loop.run();
+  }};
+  auto low  = ex::then(ex::schedule(loop.get_scheduler(0)), [] {
+    return 1;
+  });
+  auto high = ex::then(ex::schedule(loop.get_scheduler(1)), [] {
+    return 2;
+  });
+  auto [a, b] = ex::sync_wait(ex::when_all(std::move(low), std::move(high))).value();
+  CHECK(a + b == 3);
+  loop.finish();
+  t1.join();
+  t2.join();
+}
+} // namespace
@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/checked_receiver.hpp"
+#include "common/numa_fixtures.hpp"
+#include "common/stopped_scheduler.hpp"
+#include "common/utility.hpp"
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace ex = ustdex;
+
+namespace
+{
+TEST_CASE("reduce runs serially on a run_loop", "[parallel][reduce]")
+{
+  ex::run_loop loop;
+  auto values = iota(100);
+  auto sndr   = ex::reduce(loop.get_scheduler(), values, 0);
+  check_value_types<_m_list<int>>(sndr);
+  check_error_types<std::exception_ptr>(sndr);
+  check_sends_stopped<true>(sndr);
+  CHECK(ex::_par::_parallelism(loop.get_scheduler()) == 1);
+
+  auto op = ex::connect(std::move(sndr), checked_value_receiver{5050});
+  ex::start(op);
+  loop.finish();
+  loop.run();
+}
+
+TEST_CASE("reduce splits the range over the workers of a thread pool", "[parallel][reduce]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  CHECK(ex::_par::_parallelism(pool.get_scheduler()) == 3);
+  CHECK(ex::_par::_parallelism(pool.get_scheduler(1)) == 2);
+
+  for (int count : {1, 2, 3, 10, 10007})
+  {
+    auto values   = iota(count);
+    auto expected = std::accumulate(values.begin(), values.end(), 0L);
+    auto [sum]    = ex::sync_wait(ex::reduce(pool.get_scheduler(), values, 0L)).value();
+    CHECK(sum == expected);
+    auto [node_sum] = ex::sync_wait(ex::reduce(pool.get_scheduler(1), values, 0L)).value();
+    CHECK(node_sum == expected);
+  }
+}
+
+TEST_CASE("reduce of an empty range sends the initial value", "[parallel][reduce]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto [result] = ex::sync_wait(ex::reduce(pool.get_scheduler(), std::vector<int>{}, 42)).value();
+  CHECK(result == 42);
+}
+
+TEST_CASE("reduce uses the given operation", "[parallel][reduce]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto values   = iota(20);
+  auto [result] = ex::sync_wait(ex::reduce(pool.get_scheduler(), values, 0, [](int a, int b) {
+                    return a > b ? a : b;
+                  })).value();
+  CHECK(result == 20);
+}
+
+TEST_CASE("transform_reduce reduces the transformed elements", "[parallel][reduce]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto values   = iota(1000);
+  auto expected = std::transform_reduce(values.begin(), values.end(), 1L, std::plus<>(), [](int i) {
+    return long(i) * i;
+  });
+  auto sndr     = ex::transform_reduce(pool.get_scheduler(), values, 1L, std::plus<>(), [](int i) {
+    return long(i) * i;
+  });
+  check_value_types<_m_list<long>>(sndr);
+
+  auto [result] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(result == expected);
+}
+
+TEST_CASE("reduce sends an exception thrown by the operation", "[parallel][reduce]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto values = iota(100);
+  auto sndr   = ex::transform_reduce(pool.get_scheduler(), values, 0, std::plus<>(), [](int i) {
+    if (i == 50)
+    {
+      throw std::runtime_error("50");
+    }
+    return i;
+  });
+  CHECK_THROWS_AS(ex::sync_wait(std::move(sndr)), std::runtime_error);
+}
+
+TEST_CASE("reduce is stopped when its scheduler is", "[parallel][reduce]")
+{
+  auto values = iota(10);
+  auto result = ex::sync_wait(ex::reduce(stopped_scheduler{}, values, 0));
+  CHECK_FALSE(result.has_value());
+}
+} // namespace
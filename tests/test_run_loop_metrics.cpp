@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/checked_receiver.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace ex = ustdex;
+
+namespace
+{
+TEST_CASE("latency_histogram buckets are exact for small values", "[run_loop][metrics]")
+{
+  for (std::uint64_t ns = 0; ns < 16; ++ns)
+  {
+    CHECK(ex::latency_histogram::bucket_lower_bound(ex::latency_histogram::bucket_of(ns)) == ns);
+  }
+}
+
+TEST_CASE("latency_histogram buckets bound their values within 1/8", "[run_loop][metrics]")
+{
+  for (std::uint64_t ns : {17ull, 100ull, 999ull, 123456789ull, 1ull << 40, ~0ull})
+  {
+    auto bucket = ex::latency_histogram::bucket_of(ns);
+    REQUIRE(bucket < ex::latency_histogram::bucket_count);
+    auto lower = ex::latency_histogram::bucket_lower_bound(bucket);
+    CHECK(lower <= ns);
+    CHECK(ns - lower <= ns / ex::latency_histogram::sub_buckets);
+  }
+}
+
+TEST_CASE("histogram_snapshot reports percentiles", "[run_loop][metrics]")
+{
+  ex::latency_histogram histogram;
+  for (std::uint64_t ns = 1; ns <= 100; ++ns)
+  {
+    histogram.record(ns * 1000);
+  }
+  auto snap = histogram.snapshot();
+  CHECK(snap.count == 100);
+  CHECK(snap.max_ns == 100'000);
+  CHECK(snap.mean_ns() == 50'500.0);
+  CHECK(snap.percentile_ns(100) == 100'000);
+  auto p50 = snap.percentile_ns(50);
+  CHECK(p50 >= 50'000);
+  CHECK(p50 <= 50'000 + 50'000 / 8);
+}
+
+#if USTDEX_RUN_LOOP_METRICS()
+TEST_CASE("run_loop records queue depth and task timings", "[run_loop][metrics]")
+{
+  ex::run_loop loop;
+  auto sch = loop.get_scheduler();
+
+  auto sleepy = ex::then(ex::schedule(sch), [] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  });
+  auto op1 = ex::connect(sleepy, checked_value_receiver{});
+  auto op2 = ex::connect(sleepy, checked_value_receiver{});
+  ex::start(op1);
+  ex::start(op2);
+  CHECK(loop.metrics().queue_depth == 2);
+
+  loop.finish();
+  loop.run();
+
+  auto metrics = loop.metrics();
+  CHECK(metrics.queue_depth == 0);
+  CHECK(metrics.max_queue_depth == 2);
+  CHECK(metrics.queue_time.count == 2);
+  CHECK(metrics.execution_time.count == 2);
+  CHECK(metrics.execution_time.max_ns >= 2'000'000);
+  // The second task waited for the first one to run.
+  CHECK(metrics.queue_time.max_ns >= 2'000'000);
+}
+
+TEST_CASE("thread_context exposes its run_loop metrics", "[run_loop][metrics]")
+{
+  ex::thread_context ctx;
+  ex::sync_wait(ex::schedule(ctx.get_scheduler()));
+  ctx.join();
+  CHECK(ctx.metrics().execution_time.count == 1);
+}
+#endif
+} // namespace
@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/checked_receiver.hpp"
+#include "common/numa_fixtures.hpp"
+#include "common/stopped_scheduler.hpp"
+#include "common/utility.hpp"
+
+#include <array>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ex = ustdex;
+
+namespace
+{
+TEST_CASE("the serial scans can run at compile time", "[parallel][scan]")
+{
+  constexpr auto scanned = [] {
+    std::array<int, 4> values{1, 2, 3, 4};
+    std::array<int, 4> exclusive{};
+    std::array<int, 4> inclusive{};
+    ex::_exclusive_scan(values.begin(), values.end(), exclusive.begin(), 10);
+    ex::_inclusive_scan(values.begin(), values.end(), inclusive.begin(), std::plus<>());
+    return std::pair{exclusive, inclusive};
+  }();
+  STATIC_REQUIRE(scanned.first[0] == 10);
+  STATIC_REQUIRE(scanned.first[3] == 16);
+  STATIC_REQUIRE(scanned.second[0] == 1);
+  STATIC_REQUIRE(scanned.second[3] == 10);
+}
+
+TEST_CASE("inclusive_scan runs serially on a run_loop", "[parallel][scan]")
+{
+  ex::run_loop loop;
+  auto values = iota(5);
+  std::vector<int> out(5);
+  auto sndr = ex::inclusive_scan(loop.get_scheduler(), values, out.begin());
+  check_value_types<_m_list<std::vector<int>::iterator>>(sndr);
+  check_error_types<std::exception_ptr>(sndr);
+  check_sends_stopped<true>(sndr);
+
+  auto op = ex::connect(std::move(sndr), checked_value_receiver{out.end()});
+  ex::start(op);
+  loop.finish();
+  loop.run();
+  CHECK(out == std::vector<int>{1, 3, 6, 10, 15});
+}
+
+TEST_CASE("the scans split the range over the workers of a thread pool", "[parallel][scan]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  for (int count : {0, 1, 2, 3, 4, 10, 10007})
+  {
+    auto values = iota(count);
+    std::vector<long> expected(count);
+    std::vector<long> out(count);
+
+    std::inclusive_scan(values.begin(), values.end(), expected.begin(), std::plus<>(), 0L);
+    auto [inclusive_end] = ex::sync_wait(ex::inclusive_scan(pool.get_scheduler(), values, out.begin())).value();
+    CHECK(inclusive_end == out.end());
+    CHECK(out == expected);
+
+    std::inclusive_scan(values.begin(), values.end(), expected.begin(), std::plus<>(), 5L);
+    ex::sync_wait(ex::inclusive_scan(pool.get_scheduler(), values, out.begin(), std::plus<>(), 5L));
+    CHECK(out == expected);
+
+    std::exclusive_scan(values.begin(), values.end(), expected.begin(), 5L);
+    auto [exclusive_end] = ex::sync_wait(ex::exclusive_scan(pool.get_scheduler(), values, out.begin(), 5L)).value();
+    CHECK(exclusive_end == out.end());
+    CHECK(out == expected);
+  }
+}
+
+TEST_CASE("the scans can run in place", "[parallel][scan]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto values = iota(100);
+  std::vector<int> expected(100);
+  std::exclusive_scan(values.begin(), values.end(), expected.begin(), 0);
+
+  ex::sync_wait(ex::exclusive_scan(pool.get_scheduler(), values, values.begin(), 0));
+  CHECK(values == expected);
+}
+
+TEST_CASE("the scans use the given operation", "[parallel][scan]")
+{
+  // Concatenation is associative but not commutative, so the chunks must be
+  // combined in order.
+  ex::numa_thread_pool pool{two_nodes()};
+  std::vector<std::string> words{"a", "b", "c", "d", "e", "f", "g"};
+  std::vector<std::string> out(words.size());
+  ex::sync_wait(ex::inclusive_scan(pool.get_scheduler(), words, out.begin(), std::plus<>()));
+  CHECK(out == std::vector<std::string>{"a", "ab", "abc", "abcd", "abcde", "abcdef", "abcdefg"});
+}
+
+TEST_CASE("the scans send an exception thrown by the operation", "[parallel][scan]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto values = iota(100);
+  std::vector<int> out(100);
+  auto sndr = ex::inclusive_scan(pool.get_scheduler(), values, out.begin(), [](int a, int b) {
+    if (b == 50)
+    {
+      throw std::runtime_error("50");
+    }
+    return a + b;
+  });
+  CHECK_THROWS_AS(ex::sync_wait(std::move(sndr)), std::runtime_error);
+}
+
+TEST_CASE("the scans are stopped when their scheduler is", "[parallel][scan]")
+{
+  auto values = iota(10);
+  std::vector<int> out(10);
+  auto result = ex::sync_wait(ex::exclusive_scan(stopped_scheduler{}, values, out.begin(), 0));
+  CHECK_FALSE(result.has_value());
+}
+} // namespace
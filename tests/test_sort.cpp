@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/checked_receiver.hpp"
+#include "common/numa_fixtures.hpp"
+#include "common/stopped_scheduler.hpp"
+#include "common/utility.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ex = ustdex;
+
+namespace
+{
+template <class Ty>
+std::vector<Ty> random_values(std::size_t count, Ty low, Ty high)
+{
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<Ty> dist{low, high};
+  std::vector<Ty> values(count);
+  std::generate(values.begin(), values.end(), [&] {
+    return dist(gen);
+  });
+  return values;
+}
+
+TEST_CASE("sort runs serially on a run_loop", "[parallel][sort]")
+{
+  ex::run_loop loop;
+  std::vector<int> values{5, 3, 1, 4, 2};
+  auto sndr = ex::sort(loop.get_scheduler(), values);
+  check_value_types<_m_list<>>(sndr);
+  check_error_types<std::exception_ptr>(sndr);
+  check_sends_stopped<true>(sndr);
+
+  auto op = ex::connect(std::move(sndr), checked_value_receiver{});
+  ex::start(op);
+  loop.finish();
+  loop.run();
+  CHECK(values == std::vector<int>{1, 2, 3, 4, 5});
+}
+
+TEST_CASE("the radix sort orders integral keys", "[parallel][sort]")
+{
+  auto values = random_values<std::int64_t>(5000, -1000000, 1000000);
+  auto copy   = values;
+  std::vector<std::int64_t> buffer(values.size());
+  ex::_par::_radix_sort(values.begin(), values.end(), buffer.data());
+  std::sort(copy.begin(), copy.end());
+  CHECK(values == copy);
+
+  auto bytes = random_values<unsigned short>(5000, 0, 255);
+  auto copy2 = bytes;
+  std::vector<unsigned short> buffer2(bytes.size());
+  ex::_par::_radix_sort(bytes.begin(), bytes.end(), buffer2.data());
+  std::sort(copy2.begin(), copy2.end());
+  CHECK(bytes == copy2);
+}
+
+TEST_CASE("the merge buckets are balanced when keys repeat", "[parallel][sort]")
+{
+  constexpr std::size_t count = 10000;
+  constexpr std::size_t k     = 4;
+  std::less<> less;
+  for (int high : {0, 2})
+  {
+    auto values = random_values<int>(count, 0, high);
+    for (std::size_t i = 0; i < k; ++i)
+    {
+      auto [begin, end] = ex::_par::_chunk(count, k, i);
+      std::sort(values.begin() + begin, values.begin() + end);
+    }
+
+    std::size_t bounds[(k + 1) * k];
+    std::size_t offsets[k + 1];
+    ex::_par::_split(values.begin(), count, k, less, bounds, offsets);
+    int previous_max = 0;
+    for (std::size_t j = 0; j < k; ++j)
+    {
+      // Regular sampling keeps every bucket within twice its fair share.
+      CHECK(offsets[j + 1] - offsets[j] <= 2 * count / k);
+      std::size_t size = 0;
+      int min = high;
+      int max = 0;
+      for (std::size_t i = 0; i < k; ++i)
+      {
+        auto begin = bounds[j * k + i];
+        auto end   = bounds[(j + 1) * k + i];
+        REQUIRE(begin <= end);
+        size += end - begin;
+        if (begin != end)
+        {
+          min = (std::min)(min, values[begin]);
+          max = (std::max)(max, values[end - 1]);
+        }
+      }
+      CHECK(size == offsets[j + 1] - offsets[j]);
+      // Nothing in a bucket is less than anything in the buckets before it.
+      CHECK(previous_max <= min);
+      previous_max = (std::max)(previous_max, max);
+    }
+  }
+}
+
+TEST_CASE("sort orders repeated keys", "[parallel][sort]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  for (int high : {0, 2})
+  {
+    auto values   = random_values<int>(10000, 0, high);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    ex::sync_wait(ex::sort(pool.get_scheduler(), values));
+    CHECK(values == expected);
+  }
+}
+
+TEST_CASE("sort splits the range over the workers of a thread pool", "[parallel][sort]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  for (std::size_t count : {0, 1, 2, 3, 10, 100, 10007, 100000})
+  {
+    auto values   = random_values<int>(count, -500, 500);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    ex::sync_wait(ex::sort(pool.get_scheduler(), values));
+    CHECK(values == expected);
+  }
+}
+
+TEST_CASE("sort uses the given comparison", "[parallel][sort]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto values   = random_values<int>(5000, 0, 100);
+  auto expected = values;
+  std::sort(expected.begin(), expected.end(), std::greater<>());
+
+  ex::sync_wait(ex::sort(pool.get_scheduler(), values, std::greater<>()));
+  CHECK(values == expected);
+}
+
+TEST_CASE("sort moves elements that cannot be copied", "[parallel][sort]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  std::vector<std::unique_ptr<std::string>> values;
+  for (int i : random_values<int>(1000, 0, 100000))
+  {
+    values.push_back(std::make_unique<std::string>(std::to_string(i)));
+  }
+  auto by_value = [](const auto& a, const auto& b) {
+    return *a < *b;
+  };
+
+  ex::sync_wait(ex::sort(pool.get_scheduler(), values, by_value));
+  CHECK(std::is_sorted(values.begin(), values.end(), by_value));
+  CHECK(std::none_of(values.begin(), values.end(), [](const auto& p) {
+    return p == nullptr;
+  }));
+}
+
+TEST_CASE("sort sends an exception thrown by the comparison", "[parallel][sort]")
+{
+  ex::numa_thread_pool pool{two_nodes()};
+  auto values = random_values<int>(1000, 0, 100);
+  auto sndr   = ex::sort(pool.get_scheduler(), values, [](int a, int b) {
+    if (a == 50 || b == 50)
+    {
+      throw std::runtime_error("50");
+    }
+    return a < b;
+  });
+  CHECK_THROWS_AS(ex::sync_wait(std::move(sndr)), std::runtime_error);
+}
+
+TEST_CASE("sort is stopped when its scheduler is", "[parallel][sort]")
+{
+  std::vector<int> values{3, 2, 1};
+  auto result = ex::sync_wait(ex::sort(stopped_scheduler{}, values));
+  CHECK_FALSE(result.has_value());
+  CHECK(values == std::vector<int>{3, 2, 1});
+}
+} // namespace
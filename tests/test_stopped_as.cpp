@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/checked_receiver.hpp"
+#include "common/error_scheduler.hpp"
+#include "common/stopped_scheduler.hpp"
+#include "common/utility.hpp"
+
+#include <optional>
+#include <system_error>
+
+namespace ex = ustdex;
+
+namespace
+{
+TEST_CASE("stopped_as_optional sends the value in an optional", "[adaptors][stopped_as]")
+{
+  auto sndr = ex::stopped_as_optional(ex::just(42));
+  check_value_types<_m_list<std::optional<int>>>(sndr);
+  check_error_types<>(sndr);
+  check_sends_stopped<false>(sndr);
+
+  auto op = ex::connect(std::move(sndr), checked_value_receiver{std::optional<int>{42}});
+  ex::start(op);
+}
+
+TEST_CASE("stopped_as_optional sends an empty optional instead of stopped", "[adaptors][stopped_as]")
+{
+  auto sndr = ex::schedule(stopped_scheduler{}) | ex::then([] {
+                return 42;
+              })
+            | ex::stopped_as_optional();
+  check_value_types<_m_list<std::optional<int>>>(sndr);
+  check_error_types<std::exception_ptr>(sndr);
+  check_sends_stopped<false>(sndr);
+
+  auto [result] = ex::sync_wait(std::move(sndr)).value();
+  CHECK_FALSE(result.has_value());
+}
+
+TEST_CASE("stopped_as_optional passes errors through", "[adaptors][stopped_as]")
+{
+  auto sndr = ex::schedule(error_scheduler{42}) | ex::then([]() noexcept {
+                return 1;
+              })
+            | ex::stopped_as_optional();
+  check_value_types<_m_list<std::optional<int>>>(sndr);
+  check_error_types<int>(sndr);
+
+  auto op = ex::connect(std::move(sndr), checked_error_receiver{42});
+  ex::start(op);
+}
+
+TEST_CASE("stopped_as_error sends the error instead of stopped", "[adaptors][stopped_as]")
+{
+  auto ec   = std::make_error_code(std::errc::operation_canceled);
+  auto sndr = ex::schedule(stopped_scheduler{}) | ex::stopped_as_error(ec);
+  check_value_types<_m_list<>>(sndr);
+  check_error_types<std::error_code>(sndr);
+  check_sends_stopped<false>(sndr);
+
+  auto op = ex::connect(std::move(sndr), checked_error_receiver{ec});
+  ex::start(op);
+
+  CHECK_THROWS_AS(ex::sync_wait(ex::schedule(stopped_scheduler{}) | ex::stopped_as_error(ec)), std::system_error);
+}
+
+TEST_CASE("stopped_as_error leaves senders that cannot stop alone", "[adaptors][stopped_as]")
+{
+  auto sndr = ex::stopped_as_error(ex::just(42), 0);
+  check_value_types<_m_list<int>>(sndr);
+  check_error_types<>(sndr);
+  check_sends_stopped<false>(sndr);
+
+  auto op = ex::connect(std::move(sndr), checked_value_receiver{42});
+  ex::start(op);
+}
+} // namespace
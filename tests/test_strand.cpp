@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../tests/common/inline_scheduler.hpp"
+#include <catch2/catch_all.hpp>
+#include <ustdex/ustdex.hpp>
+
+namespace ex = ustdex;
+
+namespace
+{
+TEST_CASE("strand runs uncontended work inline", "[context][strand]")
+{
+  ex::run_loop loop;
+  ex::strand<ex::run_loop::_scheduler> strand{loop.get_scheduler()};
+  auto sndr = ex::then(ex::schedule(strand.get_scheduler()), [] {
+    return std::this_thread::get_id();
+  });
+  auto [id] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(id == std::this_thread::get_id());
+}
+
+TEST_CASE("strand scheduler exposes itself as completion scheduler", "[context][strand]")
+{
+  ex::strand<inline_scheduler> strand{inline_scheduler{}};
+  auto sch = strand.get_scheduler();
+  CHECK(ex::get_completion_scheduler<ex::set_value_t>(ex::get_env(ex::schedule(sch))) == sch);
+}
+
+TEST_CASE("strand never runs tasks concurrently", "[context][strand]")
+{
+  constexpr int count = 2000;
+  std::atomic<int> inside{0};
+  std::atomic<bool> overlapped{false};
+  int counter = 0;
+  {
+    auto cpu = ex::numa_topology::single_node().nodes[0].cpus[0];
+    ex::numa_thread_pool pool{ex::numa_topology{{ex::numa_node{0, {cpu, cpu, cpu, cpu}}}}};
+    ex::strand<decltype(pool.get_scheduler())> strand{pool.get_scheduler()};
+    for (int i = 0; i < count; ++i)
+    {
+      auto task = ex::then(ex::schedule(strand.get_scheduler()), [&] {
+        if (inside.fetch_add(1) != 0)
+        {
+          overlapped = true;
+        }
+        ++counter;
+        inside.fetch_sub(1);
+      });
+      ex::start_detached(ex::starts_on(pool.get_scheduler(), std::move(task)));
+    }
+    pool.join();
+  }
+  CHECK_FALSE(overlapped.load());
+  CHECK(counter == count);
+}
+
+TEST_CASE("strand preserves the order of queued tasks", "[context][strand]")
+{
+  ex::run_loop loop;
+  ex::strand<ex::run_loop::_scheduler> strand{loop.get_scheduler()};
+  std::vector<int> order;
+
+  // The first task enters the strand and, while it runs, queues more tasks
+  // which are then handed off to the run_loop.
+  ex::start_detached(ex::then(ex::schedule(strand.get_scheduler()), [&] {
+    for (int i = 1; i <= 3; ++i)
+    {
+      ex::start_detached(ex::then(ex::schedule(strand.get_scheduler()), [&order, i] {
+        order.push_back(i);
+      }));
+    }
+    order.push_back(0);
+  }));
+  CHECK(order == std::vector<int>{0});
+  loop.finish();
+  loop.run();
+  CHECK(order == std::vector<int>{0, 1, 2, 3});
+}
+} // namespace
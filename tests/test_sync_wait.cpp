@@ -0,0 +1,197 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/error_scheduler.hpp"
+#include "common/stopped_scheduler.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+namespace ex = ustdex;
+
+namespace
+{
+TEST_CASE("sync_wait returns the value of a sender that completes on another thread", "[consumers][sync_wait]")
+{
+  ex::thread_context ctx;
+  auto [id] = ex::sync_wait(ex::starts_on(ctx.get_scheduler(), ex::just()) | ex::then([] {
+                              return std::this_thread::get_id();
+                            }))
+                .value();
+  CHECK(id != std::this_thread::get_id());
+}
+
+TEST_CASE("sync_wait rethrows errors from another thread", "[consumers][sync_wait]")
+{
+  ex::thread_context ctx;
+  auto sndr1 = ex::starts_on(ctx.get_scheduler(), ex::just()) | ex::then([]() -> int {
+                 throw std::runtime_error("oops");
+               });
+  CHECK_THROWS_AS(ex::sync_wait(std::move(sndr1)), std::runtime_error);
+
+  auto sndr2 = ex::schedule(ctx.get_scheduler()) | ex::let_value([] {
+                 return ex::schedule(error_scheduler{std::make_error_code(std::errc::invalid_argument)});
+               });
+  CHECK_THROWS_AS(ex::sync_wait(std::move(sndr2)), std::system_error);
+}
+
+TEST_CASE("sync_wait returns an empty optional when stopped on another thread", "[consumers][sync_wait]")
+{
+  ex::thread_context ctx;
+  auto result = ex::sync_wait(ex::schedule(ctx.get_scheduler()) | ex::let_value([] {
+                                return ex::schedule(stopped_scheduler{});
+                              }));
+  CHECK_FALSE(result.has_value());
+}
+
+TEST_CASE("sync_wait runs work delegated to the waiting thread", "[consumers][sync_wait]")
+{
+  auto sndr = ex::read_env(ex::get_delegation_scheduler) | ex::let_value([](auto sch) {
+                return ex::schedule(sch) | ex::then([] {
+                         return std::this_thread::get_id();
+                       });
+              });
+  auto [id] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(id == std::this_thread::get_id());
+}
+
+TEST_CASE("sync_wait provides a scheduler to senders that read it", "[consumers][sync_wait]")
+{
+  auto sndr = ex::read_env(ex::get_scheduler) | ex::let_value([](auto sch) {
+                return ex::schedule(sch) | ex::then([] {
+                         return std::this_thread::get_id();
+                       });
+              });
+  auto [id] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(id == std::this_thread::get_id());
+}
+
+// Completes on a thread of its own with whether its receiver's environment is
+// empty, which it is when sync_wait waits on a signal rather than a run_loop.
+struct env_probe
+{
+  using sender_concept = ex::sender_t;
+
+  template <class Rcvr>
+  struct opstate
+  {
+    using operation_state_concept = ex::operation_state_t;
+
+    void start() & noexcept
+    {
+      thread = std::thread{[this] {
+        ex::set_value(std::move(rcvr), std::is_same_v<ex::env_of_t<Rcvr>, ex::env<>>);
+      }};
+    }
+
+    ~opstate()
+    {
+      thread.join();
+    }
+
+    Rcvr rcvr;
+    std::thread thread{};
+  };
+
+  template <class Rcvr>
+  auto connect(Rcvr rcvr) const noexcept -> opstate<Rcvr>
+  {
+    return {std::move(rcvr)};
+  }
+
+  template <class Self>
+  static constexpr auto get_completion_signatures() noexcept
+  {
+    return ex::completion_signatures<ex::set_value_t(bool)>();
+  }
+};
+
+TEST_CASE("sync_wait waits on a signal when nothing can be delegated to it", "[consumers][sync_wait]")
+{
+  // This file is built as C++20 so that the signal's std::atomic::wait path
+  // is covered; the other tests use the C++17 fallback.
+#if __cplusplus >= 202002L
+  STATIC_REQUIRE(__cpp_lib_atomic_wait >= 201907L);
+#endif
+  for (int i = 0; i < 100; ++i)
+  {
+    auto [empty] = ex::sync_wait(env_probe{}).value();
+    CHECK(empty);
+  }
+}
+
+auto odd_or_even(int i)
+{
+  return ex::just(i)
+       | ex::conditional(
+           [](int i) {
+             return i % 2 == 0;
+           },
+           ex::then([](int i) {
+             return std::string(i, 'x');
+           }),
+           ex::then([](int i) {
+             return i * 2.0;
+           }));
+}
+
+TEST_CASE("sync_wait_with_variant returns the alternative that completed", "[consumers][sync_wait]")
+{
+  using variant_t = std::variant<std::tuple<std::string>, std::tuple<double>>;
+
+  auto even = ex::sync_wait_with_variant(odd_or_even(4));
+  static_assert(std::is_same_v<decltype(even), std::optional<variant_t>>);
+  REQUIRE(even.has_value());
+  CHECK(std::get<std::tuple<std::string>>(*even) == std::tuple{std::string("xxxx")});
+
+  auto odd = ex::sync_wait_with_variant(odd_or_even(3));
+  REQUIRE(odd.has_value());
+  CHECK(std::get<std::tuple<double>>(*odd) == std::tuple{6.0});
+}
+
+TEST_CASE("sync_wait_with_variant decays the values and reports errors and stopped", "[consumers][sync_wait]")
+{
+  int i     = 42;
+  auto sndr = ex::just() | ex::then([&]() -> int& {
+                return i;
+              });
+  auto result = ex::sync_wait_with_variant(std::move(sndr));
+  static_assert(std::is_same_v<decltype(result), std::optional<std::variant<std::tuple<int>>>>);
+  CHECK(std::get<0>(*result) == std::tuple{42});
+
+  ex::thread_context ctx;
+  auto stopped = ex::sync_wait_with_variant(ex::schedule(ctx.get_scheduler()) | ex::let_value([] {
+                                              return ex::schedule(stopped_scheduler{});
+                                            }));
+  CHECK_FALSE(stopped.has_value());
+
+  auto error = ex::just() | ex::then([]() -> int {
+                 throw std::runtime_error("oops");
+               });
+  CHECK_THROWS_AS(ex::sync_wait_with_variant(std::move(error)), std::runtime_error);
+}
+} // namespace
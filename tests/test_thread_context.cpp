@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <thread>
+
+#include <catch2/catch_all.hpp>
+#include <ustdex/ustdex.hpp>
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+namespace ex = ustdex;
+
+namespace
+{
+TEST_CASE("thread_context runs work on its own thread", "[context][thread_context]")
+{
+  ex::thread_context ctx;
+  auto sndr = ex::then(ex::schedule(ctx.get_scheduler()), [] {
+    return std::this_thread::get_id();
+  });
+  auto [id]  = ex::sync_wait(std::move(sndr)).value();
+  CHECK(id != std::this_thread::get_id());
+}
+
+TEST_CASE("thread_context can be joined explicitly", "[context][thread_context]")
+{
+  ex::thread_context ctx{ex::thread_options{}};
+  ctx.join();
+  ctx.join();
+}
+
+#if defined(__linux__)
+TEST_CASE("thread_context applies the thread options", "[context][thread_context]")
+{
+  const int cpu = ex::numa_topology::single_node().nodes[0].cpus.back();
+
+  ex::thread_options opts;
+  opts.name       = "ustdex-worker-with-a-long-name";
+  opts.cpus       = {cpu};
+  opts.stack_size = 4 << 20;
+  ex::thread_context ctx{opts};
+
+  auto sndr = ex::then(ex::schedule(ctx.get_scheduler()), [] {
+    char name[16] = {};
+    ::pthread_getname_np(::pthread_self(), name, sizeof(name));
+
+    ::pthread_attr_t attr;
+    std::size_t stack_size = 0;
+    ::pthread_getattr_np(::pthread_self(), &attr);
+    ::pthread_attr_getstacksize(&attr, &stack_size);
+    ::pthread_attr_destroy(&attr);
+
+    return std::make_tuple(std::string{name}, ::sched_getcpu(), stack_size);
+  });
+
+  auto [info] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(std::get<0>(info) == "ustdex-worker-w");
+  CHECK(std::get<1>(info) == cpu);
+  CHECK(std::get<2>(info) >= std::size_t(4 << 20));
+}
+#endif
+} // namespace
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+#include "common/checked_receiver.hpp"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ex = ustdex;
+
+namespace
+{
+struct event
+{
+  std::string tag;
+  ex::trace_event kind;
+  const void* id;
+};
+
+template <class Tag>
+std::string tag_name()
+{
+  if constexpr (std::is_same_v<Tag, ex::then_t>)
+  {
+    return "then";
+  }
+  else if constexpr (std::is_same_v<Tag, ex::let_value_t>)
+  {
+    return "let_value";
+  }
+  else if constexpr (std::is_same_v<Tag, ex::when_all_t>)
+  {
+    return "when_all";
+  }
+  else
+  {
+    return "other";
+  }
+}
+
+struct recording_tracer
+{
+  template <class Tag>
+  void operator()(Tag, ex::trace_event kind, const void* id, std::chrono::steady_clock::time_point) const noexcept
+  {
+    events->push_back({tag_name<Tag>(), kind, id});
+  }
+
+  std::vector<event>* events;
+};
+
+template <class Sndr>
+auto traced(Sndr sndr, std::vector<event>& events)
+{
+  return ex::write_env(std::move(sndr), ex::prop{ex::get_tracer, recording_tracer{&events}});
+}
+
+TEST_CASE("adaptors report start and completion to the tracer", "[trace]")
+{
+  std::vector<event> events;
+  auto sndr = ex::just(41) | ex::then([](int i) {
+                return i + 1;
+              });
+  auto [result] = ex::sync_wait(traced(std::move(sndr), events)).value();
+  CHECK(result == 42);
+  REQUIRE(events.size() == 2);
+  CHECK(events[0].tag == "then");
+  CHECK(events[0].kind == ex::trace_event::start);
+  CHECK(events[1].tag == "then");
+  CHECK(events[1].kind == ex::trace_event::value);
+  CHECK(events[0].id == events[1].id);
+}
+
+TEST_CASE("nested adaptors report their own events", "[trace]")
+{
+  std::vector<event> events;
+  auto sndr = ex::when_all(ex::just(1) | ex::let_value([](int i) {
+                             return ex::just(i + 1);
+                           }),
+                           ex::just(40) | ex::then([](int) -> int {
+                             throw 42;
+                           }));
+  CHECK_THROWS_AS(ex::sync_wait(traced(std::move(sndr), events)), int);
+
+  // when_all starts first and completes last; the children are in between.
+  REQUIRE(events.size() == 6);
+  CHECK(events.front().tag == "when_all");
+  CHECK(events.front().kind == ex::trace_event::start);
+  CHECK(events.back().tag == "when_all");
+  CHECK(events.back().kind == ex::trace_event::error);
+  CHECK(events[1].tag == "let_value");
+  CHECK(events[2].tag == "let_value");
+  CHECK(events[2].kind == ex::trace_event::value);
+  CHECK(events[3].tag == "then");
+  CHECK(events[4].tag == "then");
+  CHECK(events[4].kind == ex::trace_event::error);
+}
+
+TEST_CASE("tracing compiles out without a tracer", "[trace]")
+{
+  using rcvr_t = checked_value_receiver<int>;
+  STATIC_REQUIRE(std::is_same_v<ex::_traced_rcvr_t<ex::then_t, rcvr_t>, rcvr_t>);
+
+  auto sndr = ex::just(41) | ex::then([](int i) {
+                return i + 1;
+              });
+  auto op   = ex::connect(std::move(sndr), checked_value_receiver{42});
+  ex::start(op);
+}
+} // namespace
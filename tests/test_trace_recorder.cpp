@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include this first
+#include <ustdex/ustdex.hpp>
+
+// Then include the test helpers
+#include "common/catch2.hpp" // IWYU pragma: keep
+
+#include <string>
+
+namespace ex = ustdex;
+
+namespace
+{
+std::size_t count(const std::string& json, const std::string& needle)
+{
+  std::size_t n = 0;
+  for (auto pos = json.find(needle); pos != std::string::npos; pos = json.find(needle, pos + 1))
+  {
+    ++n;
+  }
+  return n;
+}
+
+TEST_CASE("trace_recorder exports adaptors as async slices", "[trace]")
+{
+  ex::trace_recorder recorder;
+  auto sndr = ex::just(41) | ex::then([](int i) {
+                return i + 1;
+              });
+  auto [result] = ex::sync_wait(ex::write_env(std::move(sndr), ex::prop{ex::get_tracer, recorder.tracer()})).value();
+  CHECK(result == 42);
+  CHECK(recorder.recorded() == 2);
+
+  auto json = recorder.to_json();
+  CHECK(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0);
+  CHECK(count(json, "\"name\":\"then\",\"cat\":\"ustdex\",\"ph\":\"b\"") == 1);
+  CHECK(count(json, "\"name\":\"then\",\"cat\":\"ustdex\",\"ph\":\"e\"") == 1);
+  CHECK(count(json, "\"completion\":\"value\"") == 1);
+}
+
+TEST_CASE("trace_recorder exports scheduler hops as tasks with flows", "[trace]")
+{
+  ex::trace_recorder recorder;
+  ex::thread_context ctx;
+  auto sndr = ex::starts_on(ctx.get_scheduler(), ex::just(41)) | ex::then([](int i) {
+                return i + 1;
+              });
+  auto [result] = ex::sync_wait(ex::write_env(std::move(sndr), ex::prop{ex::get_tracer, recorder.tracer()})).value();
+  CHECK(result == 42);
+
+  // The task's slice ends after sync_wait has returned, so wait for the
+  // context's thread to finish recording.
+  ctx.join();
+
+  auto json = recorder.to_json();
+  // The main thread queues the task, and the context's thread runs it.
+  CHECK(count(json, "\"name\":\"thread_name\"") == 2);
+  CHECK(count(json, "\"name\":\"task\",\"cat\":\"ustdex\",\"ph\":\"B\"") == 1);
+  CHECK(count(json, "\"ph\":\"E\"") == 1);
+  CHECK(count(json, "\"name\":\"hop\",\"cat\":\"ustdex\",\"ph\":\"s\"") == 1);
+  CHECK(count(json, "\"name\":\"hop\",\"cat\":\"ustdex\",\"ph\":\"f\"") == 1);
+  CHECK(count(json, "\"name\":\"starts_on\",\"cat\":\"ustdex\",\"ph\":\"b\"") == 1);
+}
+
+TEST_CASE("trace_recorder keeps the most recent events when a buffer is full", "[trace]")
+{
+  ex::trace_recorder recorder(3);
+  auto sndr = ex::just(0) | ex::then([](int i) {
+                return i + 1;
+              })
+            | ex::then([](int i) {
+                return i + 1;
+              });
+  ex::sync_wait(ex::write_env(std::move(sndr), ex::prop{ex::get_tracer, recorder.tracer()}));
+  CHECK(recorder.recorded() == 4);
+
+  // The first event, the start of the outer then, was overwritten.
+  auto json = recorder.to_json();
+  CHECK(count(json, "\"ph\":\"b\"") == 1);
+  CHECK(count(json, "\"ph\":\"e\"") == 2);
+}
+} // namespace
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License Version 2.0 with LLVM Exceptions
+ * (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *   https://llvm.org/LICENSE.txt
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ustdex/detail/tuple.hpp"
+#include "ustdex/detail/variant.hpp"
+#include <catch2/catch_all.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace ex = ustdex;
+
+namespace
+{
+// Alternative number I. Counts destructor calls so that tests can check that
+// the right alternative was destroyed.
+template <std::size_t I>
+struct alt
+{
+  int* destroyed;
+
+  ~alt()
+  {
+    if (destroyed)
+    {
+      *destroyed = static_cast<int>(I);
+    }
+  }
+};
+
+template <std::size_t... Is>
+auto make_variant(std::index_sequence<Is...>) -> ex::_variant<alt<Is>...>;
+
+template <std::size_t N>
+using variant_t = decltype(make_variant(std::make_index_sequence<N>()));
+
+struct get_index_fn
+{
+  template <std::size_t I>
+  void operator()(std::size_t& result, const alt<I>&) const noexcept
+  {
+    result = I;
+  }
+};
+
+template <std::size_t N, std::size_t I>
+void check_visit_and_destroy()
+{
+  int destroyed = -1;
+  {
+    variant_t<N> var;
+    var.template _emplace_at<I>(&destroyed);
+    std::size_t result = ex::_npos;
+    var._visit(get_index_fn{}, var, result);
+    CHECK(result == I);
+    CHECK(destroyed == -1);
+  }
+  CHECK(destroyed == static_cast<int>(I));
+}
+
+TEST_CASE("visit and destroy a small variant", "[variant]")
+{
+  check_visit_and_destroy<2, 0>();
+  check_visit_and_destroy<2, 1>();
+}
+
+TEST_CASE("visit and destroy a large variant", "[variant]")
+{
+  check_visit_and_destroy<32, 0>();
+  check_visit_and_destroy<32, 17>();
+  check_visit_and_destroy<32, 31>();
+}
+
+TEST_CASE("emplacing into a large variant destroys the old alternative", "[variant]")
+{
+  int destroyed = -1;
+  variant_t<32> var;
+  var._emplace_at<5>(&destroyed);
+  var._emplace_at<9>(nullptr);
+  CHECK(destroyed == 5);
+  CHECK(var._index() == 9);
+}
+
+TEST_CASE("variant of trivially destructible types is trivially destructible", "[variant]")
+{
+  static_assert(std::is_trivially_destructible_v<ex::_variant<int, double>>);
+  static_assert(std::is_trivially_destructible_v<ex::_variant<ex::_tuple<ex::_nil, int>, ex::_tuple<ex::_nil>>>);
+  static_assert(!std::is_trivially_destructible_v<ex::_variant<int, std::string>>);
+  static_assert(!std::is_trivially_destructible_v<variant_t<32>>);
+}
+
+TEST_CASE("tuple of trivial types is trivial", "[tuple]")
+{
+  static_assert(std::is_trivially_destructible_v<ex::_tuple<int, double>>);
+  static_assert(std::is_trivially_copyable_v<ex::_tuple<int, double>>);
+  static_assert(!std::is_trivially_destructible_v<ex::_tuple<int, std::string>>);
+  static_assert(!std::is_trivially_copyable_v<ex::_tuple<int, std::string>>);
+}
+
+TEST_CASE("emplacing into a trivially destructible variant", "[variant]")
+{
+  ex::_variant<int, double> var;
+  var._emplace<int>(42);
+  var._emplace<double>(3.5);
+  CHECK(var._index() == 1);
+  CHECK(var._get<1>() == 3.5);
+}
+} // namespace